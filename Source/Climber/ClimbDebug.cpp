@@ -0,0 +1,29 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "ClimbDebug.h"
+
+#if CLIMB_DEBUG_ENABLED
+
+static TAutoConsoleVariable<bool> CVarClimbDebugRecord(
+  TEXT("Climber.Debug.Record"),
+  false,
+  TEXT("Records climb traces, contacts, warp targets and state changes into the visual logger.")
+);
+
+static TAutoConsoleVariable<bool> CVarClimbDebugDrawTraces(
+  TEXT("Climber.Debug.DrawTraces"),
+  false,
+  TEXT("Draws every climb trace in the world.")
+);
+
+bool ClimbDebug::IsRecording()
+{
+  return IsInGameThread() && CVarClimbDebugRecord.GetValueOnGameThread();
+}
+
+bool ClimbDebug::ShouldDrawTraces()
+{
+  return IsInGameThread() && CVarClimbDebugDrawTraces.GetValueOnGameThread();
+}
+
+#endif
@@ -0,0 +1,50 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VisualLogger/VisualLogger.h"
+
+// Climb debug recording only exists where the visual logger does, never in shipping
+#define CLIMB_DEBUG_ENABLED (ENABLE_VISUAL_LOG && !UE_BUILD_SHIPPING)
+
+namespace ClimbDebug
+{
+#if CLIMB_DEBUG_ENABLED
+  // Climber.Debug.Record, only ever true on the game thread since the visual logger is not thread safe
+  bool IsRecording();
+
+  // Climber.Debug.DrawTraces
+  bool ShouldDrawTraces();
+#else
+  constexpr bool IsRecording() { return false; }
+  constexpr bool ShouldDrawTraces() { return false; }
+#endif
+}
+
+/**
+ * Visual logger wrappers gated by Climber.Debug.Record. Entries also go to Unreal Insights traces,
+ * so recorded sessions can be scrubbed in the Rewind Debugger with the visual logger track enabled.
+ */
+#if CLIMB_DEBUG_ENABLED
+#define CLIMB_VLOG(Owner, Format, ...) \
+  do { if (ClimbDebug::IsRecording()) { UE_VLOG(Owner, LogClimbing, Log, Format, ##__VA_ARGS__); } } while (0)
+
+#define CLIMB_VLOG_SEGMENT(Owner, Start, End, Color, Format, ...) \
+  do { if (ClimbDebug::IsRecording()) { UE_VLOG_SEGMENT(Owner, LogClimbing, Log, Start, End, Color, Format, ##__VA_ARGS__); } } while (0)
+
+#define CLIMB_VLOG_ARROW(Owner, Start, End, Color, Format, ...) \
+  do { if (ClimbDebug::IsRecording()) { UE_VLOG_ARROW(Owner, LogClimbing, Log, Start, End, Color, Format, ##__VA_ARGS__); } } while (0)
+
+#define CLIMB_VLOG_LOCATION(Owner, Location, Radius, Color, Format, ...) \
+  do { if (ClimbDebug::IsRecording()) { UE_VLOG_LOCATION(Owner, LogClimbing, Log, Location, Radius, Color, Format, ##__VA_ARGS__); } } while (0)
+
+#define CLIMB_VLOG_CAPSULE(Owner, Center, HalfHeight, Radius, Color, Format, ...) \
+  do { if (ClimbDebug::IsRecording()) { UE_VLOG_CAPSULE(Owner, LogClimbing, Log, (Center) - FVector(0.f, 0.f, HalfHeight), HalfHeight, Radius, FQuat::Identity, Color, Format, ##__VA_ARGS__); } } while (0)
+#else
+#define CLIMB_VLOG(Owner, Format, ...)
+#define CLIMB_VLOG_SEGMENT(Owner, Start, End, Color, Format, ...)
+#define CLIMB_VLOG_ARROW(Owner, Start, End, Color, Format, ...)
+#define CLIMB_VLOG_LOCATION(Owner, Location, Radius, Color, Format, ...)
+#define CLIMB_VLOG_CAPSULE(Owner, Center, HalfHeight, Radius, Color, Format, ...)
+#endif
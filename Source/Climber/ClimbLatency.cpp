@@ -0,0 +1,75 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "ClimbLatency.h"
+#include "Components/CustomMovementComponent.h"
+
+#if CLIMB_LATENCY_STATS_ENABLED
+
+namespace ClimbLatency
+{
+  struct FLatencySamples
+  {
+    int32 Num = 0;
+    uint64 TotalFrames = 0;
+    uint64 MaxFrames = 0;
+    double TotalMs = 0.0;
+    double MaxMs = 0.0;
+
+    void Add(const FClimbInputStamp& InStamp)
+    {
+      const uint64 Frames = GFrameCounter - InStamp.Frame;
+      const double Ms = (FPlatformTime::Seconds() - InStamp.Time) * 1000.0;
+
+      Num++;
+      TotalFrames += Frames;
+      MaxFrames = FMath::Max(MaxFrames, Frames);
+      TotalMs += Ms;
+      MaxMs = FMath::Max(MaxMs, Ms);
+    }
+
+    void Log(const TCHAR* InLabel) const
+    {
+      if (Num == 0)
+      {
+        UE_LOG(LogClimbing, Log, TEXT("%s: no samples"), InLabel);
+        return;
+      }
+
+      UE_LOG(LogClimbing, Log, TEXT("%s: %d samples, avg %.2f frames %.2f ms, max %llu frames %.2f ms"),
+        InLabel, Num, (double)TotalFrames / Num, TotalMs / Num, MaxFrames, MaxMs);
+    }
+  };
+
+  static FCriticalSection SamplesCriticalSection;
+  static FLatencySamples InputToMovement;
+  static FLatencySamples InputToPose;
+
+  void RecordInputToMovement(const FClimbInputStamp& InStamp)
+  {
+    FScopeLock Lock(&SamplesCriticalSection);
+    InputToMovement.Add(InStamp);
+  }
+
+  void RecordInputToPose(const FClimbInputStamp& InStamp)
+  {
+    FScopeLock Lock(&SamplesCriticalSection);
+    InputToPose.Add(InStamp);
+  }
+}
+
+static FAutoConsoleCommand ClimbLatencyStatsCommand(
+  TEXT("Climber.LatencyStats"),
+  TEXT("Reports climb input to movement and input to pose latency since the last report, then resets it."),
+  FConsoleCommandDelegate::CreateLambda([]()
+  {
+    FScopeLock Lock(&ClimbLatency::SamplesCriticalSection);
+
+    ClimbLatency::InputToMovement.Log(TEXT("Input to movement"));
+    ClimbLatency::InputToPose.Log(TEXT("Input to pose"));
+
+    ClimbLatency::InputToMovement = ClimbLatency::FLatencySamples();
+    ClimbLatency::InputToPose = ClimbLatency::FLatencySamples();
+  })
+);
+
+#endif
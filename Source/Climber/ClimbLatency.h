@@ -0,0 +1,36 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Latency stats are development only, like the rest of the climb debugging
+#define CLIMB_LATENCY_STATS_ENABLED (!UE_BUILD_SHIPPING)
+
+// When a climb input was issued, carried from the input handler through movement to the pose
+struct FClimbInputStamp
+{
+  uint64 Frame = 0;
+  double Time = 0.0;
+
+  FORCEINLINE bool IsSet() const { return Frame != 0; }
+  FORCEINLINE bool operator==(const FClimbInputStamp& Other) const { return Frame == Other.Frame && Time == Other.Time; }
+  FORCEINLINE bool operator!=(const FClimbInputStamp& Other) const { return !(*this == Other); }
+
+  static FClimbInputStamp Now() { return { GFrameCounter, FPlatformTime::Seconds() }; }
+};
+
+/**
+ * Input to movement and input to pose latency in frames and milliseconds, reported by Climber.LatencyStats.
+ * Pose samples are recorded from the anim worker threads.
+ */
+namespace ClimbLatency
+{
+#if CLIMB_LATENCY_STATS_ENABLED
+  void RecordInputToMovement(const FClimbInputStamp& InStamp);
+  void RecordInputToPose(const FClimbInputStamp& InStamp);
+#else
+  FORCEINLINE void RecordInputToMovement(const FClimbInputStamp& InStamp) {}
+  FORCEINLINE void RecordInputToPose(const FClimbInputStamp& InStamp) {}
+#endif
+}
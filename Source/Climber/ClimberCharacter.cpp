@@ -5,12 +5,13 @@
 #include "Camera/CameraComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/CustomMovementComponent.h"
-#include "GameFramework/SpringArmComponent.h"
+#include "Components/ClimbSpringArmComponent.h"
 #include "GameFramework/Controller.h"
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
 #include "InputActionValue.h"
 #include "MotionWarpingComponent.h"
+#include "Components/ClimbIKComponent.h"
 #include "DebugHelper.h"
 
 DEFINE_LOG_CATEGORY(LogTemplateCharacter);
@@ -44,7 +45,7 @@ AClimberCharacter::AClimberCharacter(const FObjectInitializer& objectInitializer
   GetCharacterMovement()->BrakingDecelerationFalling = 1500.0f;
 
   // Create a camera boom (pulls in towards the player if there is a collision)
-  CameraBoom = CreateDefaultSubobject<USpringArmComponent>(TEXT("CameraBoom"));
+  CameraBoom = CreateDefaultSubobject<UClimbSpringArmComponent>(TEXT("CameraBoom"));
   CameraBoom->SetupAttachment(RootComponent);
   CameraBoom->TargetArmLength = 400.0f; // The camera follows at this distance behind the character	
   CameraBoom->bUsePawnControlRotation = true; // Rotate the arm based on the controller
@@ -55,6 +56,8 @@ AClimberCharacter::AClimberCharacter(const FObjectInitializer& objectInitializer
   FollowCamera->bUsePawnControlRotation = false; // Camera does not rotate relative to arm
 
   MotionWarpingComponent = CreateDefaultSubobject<UMotionWarpingComponent>(TEXT("MotionWarpingComp"));
+
+  ClimbIKComponent = CreateDefaultSubobject<UClimbIKComponent>(TEXT("ClimbIKComp"));
 }
 
 void AClimberCharacter::BeginPlay()
@@ -62,8 +65,6 @@ void AClimberCharacter::BeginPlay()
   // Call the base class  
   Super::BeginPlay();
 
-  AddInputMappingContext(DefaultMappingContext, 0);
-
   if (CustomMovementComponent)
   {
     CustomMovementComponent->OnEnterClimbStateDelegate.BindUObject(this, &ThisClass::OnPlayerEnterClimbState);
@@ -71,6 +72,43 @@ void AClimberCharacter::BeginPlay()
   }
 }
 
+void AClimberCharacter::NotifyControllerChanged()
+{
+  // The previous controller's local player keeps its contexts otherwise
+  if (const APlayerController* PreviousPlayerController = Cast<APlayerController>(PreviousController))
+  {
+    if (UEnhancedInputLocalPlayerSubsystem* Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PreviousPlayerController->GetLocalPlayer()))
+    {
+      if (DefaultMappingContext) Subsystem->RemoveMappingContext(DefaultMappingContext);
+      if (ClimbMappingContext) Subsystem->RemoveMappingContext(ClimbMappingContext);
+    }
+  }
+
+  Super::NotifyControllerChanged();
+
+  AddInputMappingContext(DefaultMappingContext, 0);
+
+  if (CustomMovementComponent && CustomMovementComponent->IsClimbing())
+  {
+    AddInputMappingContext(ClimbMappingContext, 1);
+  }
+}
+
+void AClimberCharacter::ResetClimbState()
+{
+  if (CustomMovementComponent)
+  {
+    CustomMovementComponent->ResetClimbState();
+  }
+
+  if (ClimbIKComponent)
+  {
+    ClimbIKComponent->ResetIKTargets();
+  }
+
+  CameraBoom->SetClimbCameraMode(false);
+}
+
 void AClimberCharacter::AddInputMappingContext(UInputMappingContext* ContextToAdd, int32 InPriority)
 {
   if (!ContextToAdd) return;
@@ -157,6 +195,8 @@ void AClimberCharacter::HandleClimbMovementInput(const FInputActionValue& Value)
   // input is a Vector2D
   const FVector2D MovementVector = Value.Get<FVector2D>();
 
+  CustomMovementComponent->StampClimbInput();
+
   const FVector ForwardDirection = FVector::CrossProduct(-CustomMovementComponent->GetClimbableSurfaceNormal(), GetActorRightVector());
 
   const FVector RightDirection = FVector::CrossProduct(-CustomMovementComponent->GetClimbableSurfaceNormal(), -GetActorUpVector());
@@ -182,6 +222,8 @@ void AClimberCharacter::OnClimbActionStarted(const FInputActionValue& Value)
 {
   if (!CustomMovementComponent) return;
 
+  CustomMovementComponent->StampClimbInput();
+
   if (!CustomMovementComponent->IsClimbing())
   {
     CustomMovementComponent->ToggleClimbing(true);
@@ -195,17 +237,20 @@ void AClimberCharacter::OnClimbActionStarted(const FInputActionValue& Value)
 void AClimberCharacter::OnPlayerEnterClimbState()
 {
   AddInputMappingContext(ClimbMappingContext, 1);
+  CameraBoom->SetClimbCameraMode(true);
 }
 
 void AClimberCharacter::OnPlayerExitClimbState()
 {
   RemoveInputMappingContext(ClimbMappingContext);
+  CameraBoom->SetClimbCameraMode(false);
 }
 
 void AClimberCharacter::OnClimbHopActionStarted(const FInputActionValue& Value)
 {
   if (CustomMovementComponent)
   {
+    CustomMovementComponent->StampClimbInput();
     CustomMovementComponent->RequestHopping();
   }
 }
\ No newline at end of file
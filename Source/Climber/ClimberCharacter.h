@@ -7,12 +7,13 @@
 #include "Logging/LogMacros.h"
 #include "ClimberCharacter.generated.h"
 
-class USpringArmComponent;
+class UClimbSpringArmComponent;
 class UCameraComponent;
 class UInputMappingContext;
 class UInputAction;
 class UCustomMovementComponent;
 class UMotionWarpingComponent;
+class UClimbIKComponent;
 struct FInputActionValue;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogTemplateCharacter, Log, All);
@@ -25,10 +26,13 @@ class AClimberCharacter : public ACharacter
 public:
 	AClimberCharacter(const FObjectInitializer& objectInitializer);
 
+	// Clears climbing, IK and camera state so a pooled climber can be reused without BeginPlay
+	void ResetClimbState();
+
 #pragma region Components
-	/** Camera boom positioning the camera behind the character */
+	/** Camera boom positioning the camera behind the character, switches to its climb camera mode while climbing */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Camera, meta = (AllowPrivateAccess = "true"))
-	USpringArmComponent* CameraBoom;
+	UClimbSpringArmComponent* CameraBoom;
 
 	/** Follow camera */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Camera, meta = (AllowPrivateAccess = "true"))
@@ -39,6 +43,9 @@ public:
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Movement, meta = (AllowPrivateAccess = "true"))
 	UMotionWarpingComponent* MotionWarpingComponent;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Movement, meta = (AllowPrivateAccess = "true"))
+	UClimbIKComponent* ClimbIKComponent;
 #pragma endregion
 
 #pragma region Input
@@ -95,15 +102,18 @@ protected:
 	// APawn interface
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 	
-	// To add mapping context
 	virtual void BeginPlay();
 
+	// To add mapping context, on possession rather than BeginPlay so pooled climbers get theirs on reuse
+	virtual void NotifyControllerChanged() override;
+
 public:
 	/** Returns CameraBoom subobject **/
-	FORCEINLINE class USpringArmComponent* GetCameraBoom() const { return CameraBoom; }
+	FORCEINLINE UClimbSpringArmComponent* GetCameraBoom() const { return CameraBoom; }
 	/** Returns FollowCamera subobject **/
 	FORCEINLINE class UCameraComponent* GetFollowCamera() const { return FollowCamera; }
 	FORCEINLINE UCustomMovementComponent* GetCustomMovementComponent() const { return CustomMovementComponent; }
 	FORCEINLINE UMotionWarpingComponent* GetMotionWarpingComponent() const { return MotionWarpingComponent; }
+	FORCEINLINE UClimbIKComponent* GetClimbIKComponent() const { return ClimbIKComponent; }
 };
 
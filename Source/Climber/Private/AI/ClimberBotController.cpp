@@ -0,0 +1,102 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AI/ClimberBotController.h"
+#include "Components/CustomMovementComponent.h"
+#include "GameFramework/Character.h"
+
+AClimberBotController::AClimberBotController()
+{
+  PrimaryActorTick.bCanEverTick = true;
+  bWantsPlayerState = false;
+}
+
+void AClimberBotController::OnPossess(APawn* InPawn)
+{
+  Super::OnPossess(InPawn);
+
+  const ACharacter* BotCharacter = Cast<ACharacter>(InPawn);
+  BotMovementComponent = BotCharacter ? Cast<UCustomMovementComponent>(BotCharacter->GetCharacterMovement()) : nullptr;
+
+  // Bots of a generated map share the seed, their spawn location keeps their patterns apart but repeatable
+  RandomStream.Initialize(HashCombine(GetTypeHash(Seed), GetTypeHash(InPawn->GetActorLocation())));
+  TimeUntilClimbAttempt = RandomStream.FRandRange(0.f, ClimbAttemptInterval);
+  WeavePhase = RandomStream.FRandRange(0.f, WeavePeriod);
+  bWasClimbing = false;
+}
+
+void AClimberBotController::OnUnPossess()
+{
+  BotMovementComponent = nullptr;
+
+  Super::OnUnPossess();
+}
+
+void AClimberBotController::Tick(float DeltaTime)
+{
+  Super::Tick(DeltaTime);
+
+  if (!BotMovementComponent || !GetPawn()) return;
+
+  const bool bIsClimbing = BotMovementComponent->IsClimbing();
+  if (bIsClimbing && !bWasClimbing)
+  {
+    TimeUntilLetGo = RandomStream.FRandRange(ClimbDurationRange.X, ClimbDurationRange.Y);
+    TimeUntilHop = RandomStream.FRandRange(HopIntervalRange.X, HopIntervalRange.Y);
+  }
+  bWasClimbing = bIsClimbing;
+
+  if (bIsClimbing)
+  {
+    TickClimbing(DeltaTime);
+  }
+  else
+  {
+    TickGround(DeltaTime);
+  }
+}
+
+void AClimberBotController::TickGround(float DeltaTime)
+{
+  APawn* BotPawn = GetPawn();
+
+  // Bots are spawned facing their wall, keep walking into it
+  BotPawn->AddMovementInput(BotPawn->GetActorForwardVector(), 1.f);
+
+  TimeUntilClimbAttempt -= DeltaTime;
+  if (TimeUntilClimbAttempt > 0.f) return;
+
+  TimeUntilClimbAttempt = ClimbAttemptInterval;
+  BotMovementComponent->ToggleClimbing(true);
+}
+
+void AClimberBotController::TickClimbing(float DeltaTime)
+{
+  APawn* BotPawn = GetPawn();
+
+  // Same input axes as AClimberCharacter::HandleClimbMovementInput
+  const FVector SurfaceNormal = BotMovementComponent->GetClimbableSurfaceNormal();
+  const FVector UpDirection = FVector::CrossProduct(-SurfaceNormal, BotPawn->GetActorRightVector());
+  const FVector RightDirection = FVector::CrossProduct(-SurfaceNormal, -BotPawn->GetActorUpVector());
+
+  WeavePhase += DeltaTime;
+  const float Weave = FMath::Sin(WeavePhase * UE_TWO_PI / FMath::Max(WeavePeriod, UE_KINDA_SMALL_NUMBER));
+
+  BotPawn->AddMovementInput(UpDirection, 1.f);
+  BotPawn->AddMovementInput(RightDirection, Weave);
+
+  // Hops read the input of the last movement tick, which is the pattern applied above on earlier frames
+  TimeUntilHop -= DeltaTime;
+  if (TimeUntilHop <= 0.f)
+  {
+    TimeUntilHop = RandomStream.FRandRange(HopIntervalRange.X, HopIntervalRange.Y);
+    BotMovementComponent->RequestHopping();
+  }
+
+  TimeUntilLetGo -= DeltaTime;
+  if (TimeUntilLetGo <= 0.f)
+  {
+    BotMovementComponent->ToggleClimbing(false);
+    TimeUntilClimbAttempt = ClimbAttemptInterval;
+  }
+}
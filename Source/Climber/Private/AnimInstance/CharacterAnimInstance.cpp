@@ -4,6 +4,7 @@
 #include "AnimInstance/CharacterAnimInstance.h"
 #include "Climber/ClimberCharacter.h"
 #include "Components/CustomMovementComponent.h"
+#include "Components/ClimbIKComponent.h"
 #include "Kismet/KismetMathLibrary.h"
 
 void UCharacterAnimInstance::NativeInitializeAnimation()
@@ -15,52 +16,78 @@ void UCharacterAnimInstance::NativeInitializeAnimation()
 	if (ClimberCharacter)
 	{
 		CustomMovementComponent = ClimberCharacter->GetCustomMovementComponent();
+		ClimbIKComponent = ClimberCharacter->GetClimbIKComponent();
 	}
 }
 
-void UCharacterAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
+void UCharacterAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
 {
-	Super::NativeUpdateAnimation(DeltaSeconds);
+	Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
 
-	if (!ClimberCharacter || !CustomMovementComponent) return;
+	if (CustomMovementComponent)
+	{
+		// Published by this frame's movement tick, which the mesh tick depends on
+		const FClimbAnimSnapshot Snapshot = CustomMovementComponent->GetClimbAnimSnapshot();
+
+		GetGroundSpeed(Snapshot);
+		GetAirSpeed(Snapshot);
+		GetIsFalling(Snapshot);
+		GetShouldMove(Snapshot);
+		GetIsClimbing(Snapshot);
+		GetClimbVelocity(Snapshot);
+
+		if (Snapshot.InputStamp.IsSet() && Snapshot.InputStamp != LastPosedInputStamp)
+		{
+			ClimbLatency::RecordInputToPose(Snapshot.InputStamp);
+			LastPosedInputStamp = Snapshot.InputStamp;
+		}
+	}
+
+	if (!ClimbIKComponent) return;
 
-	GetGroundSpeed();
-	GetAirSpeed();
-	GetShouldMove();
-	GetIsFalling();
-	GetIsClimbing();
-	GetClimbVelocity();
+	GetClimbIKTargets();
 }
 
-void UCharacterAnimInstance::GetGroundSpeed()
+void UCharacterAnimInstance::GetGroundSpeed(const FClimbAnimSnapshot& Snapshot)
 {
-	GroundSpeed = UKismetMathLibrary::VSizeXY(ClimberCharacter->GetVelocity());
+	GroundSpeed = UKismetMathLibrary::VSizeXY(Snapshot.Velocity);
 }
 
-void UCharacterAnimInstance::GetAirSpeed()
+void UCharacterAnimInstance::GetAirSpeed(const FClimbAnimSnapshot& Snapshot)
 {
-	AirSpeed = ClimberCharacter->GetVelocity().Z;
+	AirSpeed = Snapshot.Velocity.Z;
 }
 
-void UCharacterAnimInstance::GetShouldMove()
+void UCharacterAnimInstance::GetShouldMove(const FClimbAnimSnapshot& Snapshot)
 {
 	bShouldMove =
-		CustomMovementComponent->GetCurrentAcceleration().Size() > 0 &&
+		Snapshot.Acceleration.Size() > 0 &&
 		GroundSpeed > 5.f &&
 		!bIsFalling;
 }
  
-void UCharacterAnimInstance::GetIsFalling()
+void UCharacterAnimInstance::GetIsFalling(const FClimbAnimSnapshot& Snapshot)
 {
-	bIsFalling = CustomMovementComponent->IsFalling();
+	bIsFalling = Snapshot.bIsFalling;
 }
 
-void UCharacterAnimInstance::GetIsClimbing()
+void UCharacterAnimInstance::GetIsClimbing(const FClimbAnimSnapshot& Snapshot)
 {
-	bIsClimbing = CustomMovementComponent->IsClimbing();
+	bIsClimbing = Snapshot.bIsClimbing;
 }
 
-void UCharacterAnimInstance::GetClimbVelocity()
+void UCharacterAnimInstance::GetClimbVelocity(const FClimbAnimSnapshot& Snapshot)
 {
-	ClimbVelocity = CustomMovementComponent->GetUnrotatedClimbVelocity();
+	ClimbVelocity = Snapshot.ClimbVelocity;
+}
+
+void UCharacterAnimInstance::GetClimbIKTargets()
+{
+	const FClimbIKTargets IKTargets = ClimbIKComponent->GetIKTargets();
+
+	LeftHandIKLocation = IKTargets.GetLocation(EClimbLimb::LeftHand);
+	RightHandIKLocation = IKTargets.GetLocation(EClimbLimb::RightHand);
+	LeftFootIKLocation = IKTargets.GetLocation(EClimbLimb::LeftFoot);
+	RightFootIKLocation = IKTargets.GetLocation(EClimbLimb::RightFoot);
+	ClimbIKAlpha = IKTargets.Alpha;
 }
\ No newline at end of file
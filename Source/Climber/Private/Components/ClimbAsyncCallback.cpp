@@ -0,0 +1,57 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbAsyncCallback.h"
+#include "Physics/GenericPhysicsInterface.h"
+#include "Chaos/Capsule.h"
+
+void FClimbAsyncCallback::OnPreSimulate_Internal()
+{
+  const FClimbAsyncInput* Input = GetConsumerInput_Internal();
+  if (!Input || !Input->bClimbing || !Input->World) return;
+
+  FClimbAsyncOutput& Output = GetProducerOutputData_Internal();
+  Output.Frame = Input->Frame;
+
+  const FVector SurfaceTraceStart = Input->Frame.Location + Input->Frame.GetForwardVector() * Input->SurfaceTraceOffset;
+  Output.SurfaceTraceOrigin = SurfaceTraceStart;
+  SweepCapsule(*Input, SurfaceTraceStart, SurfaceTraceStart + Input->Frame.GetForwardVector(), EClimbTraceTarget::ClimbableSurfaces, Output.SurfaceHits);
+
+  const FVector DownVector = -Input->Frame.GetUpVector();
+  const FVector FloorTraceStart = Input->Frame.Location + DownVector * Input->FloorTraceOffset;
+  SweepCapsule(*Input, FloorTraceStart, FloorTraceStart + DownVector, EClimbTraceTarget::World, Output.FloorHits);
+
+  Output.bValid = true;
+}
+
+void FClimbAsyncCallback::SweepCapsule(const FClimbAsyncInput& InInput, const FVector& InStart, const FVector& InEnd, EClimbTraceTarget InTarget, TArray<FHitResult>& OutHits)
+{
+  // Upright capsule, the same shape and identity rotation as FCollisionShape::MakeCapsule on the game thread
+  const float SegmentHalfLength = FMath::Max(InInput.CapsuleTraceHalfHeight - InInput.CapsuleTraceRadius, 0.f);
+  const Chaos::FCapsule CapsuleGeometry(Chaos::FVec3(0., 0., -SegmentHalfLength), Chaos::FVec3(0., 0., SegmentHalfLength), InInput.CapsuleTraceRadius);
+
+  // Climb surface properties come from the physical material of each hit, as on the game thread
+  FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ClimbAsyncCapsuleTrace), false);
+  QueryParams.bReturnPhysicalMaterial = InTarget == EClimbTraceTarget::ClimbableSurfaces;
+
+  // Touches instead of blocks, see UCustomMovementComponent::DoCapsuleTraceMulti
+  const FCollisionResponseParams ResponseParams(ECR_Overlap);
+
+  // Same targets as the game thread, world probes are object type queries
+  const FCollisionObjectQueryParams ObjectParams = InTarget == EClimbTraceTarget::World
+    ? FCollisionObjectQueryParams(InInput.WorldObjectType)
+    : FCollisionObjectQueryParams::DefaultObjectQueryParam;
+
+  FGenericPhysicsInterface_Internal::GeomSweepMulti(
+    InInput.World,
+    CapsuleGeometry,
+    FQuat::Identity,
+    OutHits,
+    InStart,
+    InEnd,
+    InInput.TraceChannel,
+    QueryParams,
+    ResponseParams,
+    ObjectParams
+  );
+}
@@ -0,0 +1,62 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Chaos/SimCallbackInput.h"
+#include "Chaos/SimCallbackObject.h"
+#include "Components/CustomMovementComponent.h"
+
+// Written by the game thread after each climb move, consumed by every physics step until the next one
+struct FClimbAsyncInput : public Chaos::FSimCallbackInput
+{
+  const UWorld* World = nullptr;
+
+  FClimbProbeFrame Frame;
+  bool bClimbing = false;
+
+  float CapsuleTraceRadius = 0.f;
+  float CapsuleTraceHalfHeight = 0.f;
+  float SurfaceTraceOffset = 0.f;
+  float FloorTraceOffset = 0.f;
+  ECollisionChannel TraceChannel = ECC_Climbable;
+
+  // Floors need not be climbable, they are traced by object type
+  ECollisionChannel WorldObjectType = ECC_WorldStatic;
+
+  void Reset()
+  {
+    World = nullptr;
+    bClimbing = false;
+  }
+};
+
+// Probe results of one physics step, popped by the game thread at the start of the next PhysClimb
+struct FClimbAsyncOutput : public Chaos::FSimCallbackOutput
+{
+  FClimbProbeFrame Frame;
+  TArray<FHitResult> SurfaceHits;
+  FVector SurfaceTraceOrigin = FVector::ZeroVector;
+  TArray<FHitResult> FloorHits;
+  bool bValid = false;
+
+  void Reset()
+  {
+    SurfaceHits.Reset();
+    FloorHits.Reset();
+    bValid = false;
+  }
+};
+
+/**
+ * Runs the climb surface and floor probes on the physics thread against the physics thread scene,
+ * at the fixed rate of async physics instead of blocking the game thread.
+ */
+class FClimbAsyncCallback : public Chaos::TSimCallbackObject<FClimbAsyncInput, FClimbAsyncOutput>
+{
+private:
+  virtual void OnPreSimulate_Internal() override;
+
+  // Capsule sweep from InStart to InEnd against the physics thread scene, matching UCustomMovementComponent::DoCapsuleTraceMulti
+  static void SweepCapsule(const FClimbAsyncInput& InInput, const FVector& InStart, const FVector& InEnd, EClimbTraceTarget InTarget, TArray<FHitResult>& OutHits);
+};
@@ -0,0 +1,180 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Components/ClimbIKComponent.h"
+#include "Components/CustomMovementComponent.h"
+#include "Subsystems/ClimbProbeBudgetSubsystem.h"
+#include "Climber/ClimbDebug.h"
+#include "GameFramework/Character.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+
+UClimbIKComponent::UClimbIKComponent()
+{
+  PrimaryComponentTick.bCanEverTick = true;
+  PrimaryComponentTick.TickGroup = TG_PrePhysics;
+}
+
+void UClimbIKComponent::BeginPlay()
+{
+  Super::BeginPlay();
+
+  const ACharacter* CharacterOwner = Cast<ACharacter>(GetOwner());
+  MovementComponent = CharacterOwner ? Cast<UCustomMovementComponent>(CharacterOwner->GetCharacterMovement()) : nullptr;
+
+  if (!MovementComponent)
+  {
+    SetComponentTickEnabled(false);
+    return;
+  }
+
+  // Contacts are gathered by the movement tick, targets are read by the mesh tick
+  AddTickPrerequisiteComponent(MovementComponent);
+  CharacterOwner->GetMesh()->AddTickPrerequisiteComponent(this);
+
+  RefinementTraceDelegate.BindUObject(this, &ThisClass::OnRefinementTraceDone);
+}
+
+void UClimbIKComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+  Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+  const bool bHasContacts = MovementComponent->IsClimbing() && !MovementComponent->GetClimbContacts().IsEmpty();
+
+  FClimbIKTargets NewTargets;
+  {
+    FReadScopeLock ReadLock(IKTargetsLock);
+    NewTargets = IKTargets;
+  }
+  NewTargets.Alpha = FMath::FInterpTo(NewTargets.Alpha, bHasContacts ? 1.f : 0.f, DeltaTime, AlphaInterpSpeed);
+
+  if (bHasContacts)
+  {
+    for (int32 LimbIndex = 0; LimbIndex < static_cast<int32>(EClimbLimb::Num); LimbIndex++)
+    {
+      const EClimbLimb Limb = static_cast<EClimbLimb>(LimbIndex);
+      FLimbState& LimbState = LimbStates[LimbIndex];
+
+      LimbState.Estimate = EstimateLimbTarget(Limb, LimbState.EstimateNormal);
+
+      const bool bNeedsRefinement = !LimbState.bRefined
+        || FVector::DistSquared(LimbState.Estimate, LimbState.RefinedFrom) > FMath::Square(RefineDistance);
+
+      if (bNeedsRefinement && !LimbState.bRefinementPending)
+      {
+        // Deferred limbs keep their estimate and ask again next frame
+        UClimbProbeBudgetSubsystem::RunProbe(MovementComponent, 1, [this, Limb, &LimbState]()
+        {
+          RequestRefinement(Limb, LimbState.Estimate, LimbState.EstimateNormal);
+        });
+      }
+
+      // Refined targets lag a frame behind, only trust them while the estimate stays close
+      const bool bUseRefined = LimbState.bRefined
+        && FVector::DistSquared(LimbState.Estimate, LimbState.RefinedFrom) <= FMath::Square(RefineDistance);
+
+      NewTargets.Locations[LimbIndex] = bUseRefined ? LimbState.RefinedLocation : LimbState.Estimate;
+      NewTargets.Normals[LimbIndex] = bUseRefined ? LimbState.RefinedNormal : LimbState.EstimateNormal;
+
+      CLIMB_VLOG_LOCATION(this, NewTargets.Locations[LimbIndex], 5.f, bUseRefined ? FColor::Green : FColor::Orange,
+        TEXT("%s"), *UEnum::GetDisplayValueAsText(Limb).ToString());
+    }
+  }
+  else
+  {
+    for (FLimbState& LimbState : LimbStates)
+    {
+      LimbState.bRefined = false;
+    }
+  }
+
+  FWriteScopeLock WriteLock(IKTargetsLock);
+  IKTargets = NewTargets;
+}
+
+FClimbIKTargets UClimbIKComponent::GetIKTargets() const
+{
+  FReadScopeLock ReadLock(IKTargetsLock);
+  return IKTargets;
+}
+
+void UClimbIKComponent::ResetIKTargets()
+{
+  for (FLimbState& LimbState : LimbStates)
+  {
+    LimbState = FLimbState();
+  }
+
+  FWriteScopeLock WriteLock(IKTargetsLock);
+  IKTargets = FClimbIKTargets();
+}
+
+FVector UClimbIKComponent::EstimateLimbTarget(EClimbLimb InLimb, FVector& OutNormal) const
+{
+  const FTransform OwnerTransform = GetOwner()->GetActorTransform();
+  const FVector RestPosition = OwnerTransform.TransformPosition(LimbOffsets[static_cast<int32>(InLimb)]);
+
+  const TConstArrayView<FClimbContact> Contacts = MovementComponent->GetClimbContacts();
+  const FVector ContactsOrigin = MovementComponent->GetClimbContactsOrigin();
+
+  // Closest contact to the rest position, its plane is the best local guess of the surface under the limb
+  float ClosestDistSquared = TNumericLimits<float>::Max();
+  FVector ClosestPoint = RestPosition;
+  OutNormal = MovementComponent->GetClimbableSurfaceNormal();
+
+  for (const FClimbContact& Contact : Contacts)
+  {
+    const FVector ContactPoint = Contact.GetPoint(ContactsOrigin);
+    const float DistSquared = FVector::DistSquared(ContactPoint, RestPosition);
+    if (DistSquared >= ClosestDistSquared) continue;
+
+    ClosestDistSquared = DistSquared;
+    ClosestPoint = ContactPoint;
+    OutNormal = Contact.GetNormal();
+  }
+
+  return FVector::PointPlaneProject(RestPosition, ClosestPoint, OutNormal);
+}
+
+void UClimbIKComponent::RequestRefinement(EClimbLimb InLimb, const FVector& InEstimate, const FVector& InNormal)
+{
+  FLimbState& LimbState = LimbStates[static_cast<int32>(InLimb)];
+  LimbState.RefinedFrom = InEstimate;
+  LimbState.bRefinementPending = true;
+
+  FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ClimbIKRefinementTrace), false, GetOwner());
+
+  // Async traces requested during the frame run together and come back at the start of the next one
+  GetWorld()->AsyncLineTraceByChannel(
+    EAsyncTraceType::Single,
+    InEstimate + InNormal * RefineTraceDepth,
+    InEstimate - InNormal * RefineTraceDepth,
+    MovementComponent->GetClimbableTraceChannel(),
+    QueryParams,
+    FCollisionResponseParams::DefaultResponseParam,
+    &RefinementTraceDelegate,
+    static_cast<uint32>(InLimb)
+  );
+}
+
+void UClimbIKComponent::OnRefinementTraceDone(const FTraceHandle& InTraceHandle, FTraceDatum& InTraceDatum)
+{
+  if (InTraceDatum.UserData >= static_cast<uint32>(EClimbLimb::Num)) return;
+
+  FLimbState& LimbState = LimbStates[InTraceDatum.UserData];
+  LimbState.bRefinementPending = false;
+
+  if (InTraceDatum.OutHits.IsEmpty() || !InTraceDatum.OutHits[0].bBlockingHit)
+  {
+    // Nothing under the limb, keep the estimate until the limb moves on
+    LimbState.RefinedLocation = LimbState.RefinedFrom;
+    LimbState.RefinedNormal = LimbState.EstimateNormal;
+  }
+  else
+  {
+    LimbState.RefinedLocation = InTraceDatum.OutHits[0].ImpactPoint;
+    LimbState.RefinedNormal = InTraceDatum.OutHits[0].ImpactNormal;
+  }
+
+  LimbState.bRefined = true;
+}
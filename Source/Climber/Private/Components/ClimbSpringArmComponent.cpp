@@ -0,0 +1,131 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Components/ClimbSpringArmComponent.h"
+#include "Components/CustomMovementComponent.h"
+#include "GameFramework/Character.h"
+#include "Engine/World.h"
+
+void UClimbSpringArmComponent::BeginPlay()
+{
+  Super::BeginPlay();
+
+  const ACharacter* CharacterOwner = Cast<ACharacter>(GetOwner());
+  MovementComponent = CharacterOwner ? Cast<UCustomMovementComponent>(CharacterOwner->GetCharacterMovement()) : nullptr;
+
+  WalkTargetOffset = TargetOffset;
+  WalkTargetArmLength = TargetArmLength;
+}
+
+void UClimbSpringArmComponent::SetClimbCameraMode(bool bEnable)
+{
+  if (bClimbCameraMode == bEnable) return;
+
+  bClimbCameraMode = bEnable;
+
+  if (bClimbCameraMode)
+  {
+    // Keep anything set at runtime while walking, e.g. by a camera blueprint
+    if (ClimbSurfaceOffsetAlpha <= 0.f)
+    {
+      WalkTargetOffset = TargetOffset;
+    }
+    WalkTargetArmLength = TargetArmLength;
+    ClimbProbedArmLength = TargetArmLength;
+
+    // Probe on the first climbing frame
+    TimeSinceClimbProbe = ClimbProbeInterval;
+    bClimbProbeBlocked = false;
+  }
+  else
+  {
+    TargetArmLength = WalkTargetArmLength;
+  }
+}
+
+void UClimbSpringArmComponent::UpdateDesiredArmLocation(bool bDoTrace, bool bDoLocationLag, bool bDoRotationLag, float DeltaTime)
+{
+  UpdateClimbSurfaceOffset(DeltaTime);
+
+  if (!bClimbCameraMode)
+  {
+    Super::UpdateDesiredArmLocation(bDoTrace, bDoLocationLag, bDoRotationLag, DeltaTime);
+    return;
+  }
+
+  TimeSinceClimbProbe += DeltaTime;
+  if (bDoTrace && (bClimbProbeBlocked || TimeSinceClimbProbe >= ClimbProbeInterval))
+  {
+    TimeSinceClimbProbe = 0.f;
+    ProbeClimbArmLength();
+  }
+
+  TargetArmLength = ClimbProbedArmLength < TargetArmLength
+    ? ClimbProbedArmLength
+    : FMath::FInterpTo(TargetArmLength, ClimbProbedArmLength, DeltaTime, ClimbArmLengthInterpSpeed);
+
+  // The probe above stands in for the spring arm sweep
+  Super::UpdateDesiredArmLocation(false, bDoLocationLag, bDoRotationLag, DeltaTime);
+}
+
+void UClimbSpringArmComponent::UpdateClimbSurfaceOffset(float DeltaTime)
+{
+  if (!bClimbCameraMode && ClimbSurfaceOffsetAlpha <= 0.f) return;
+
+  if (bClimbCameraMode && MovementComponent && !MovementComponent->GetClimbableSurfaceNormal().IsNearlyZero())
+  {
+    ClimbSurfaceNormal = FMath::VInterpNormalRotationTo(
+      ClimbSurfaceNormal.IsNearlyZero() ? MovementComponent->GetClimbableSurfaceNormal() : ClimbSurfaceNormal,
+      MovementComponent->GetClimbableSurfaceNormal(),
+      DeltaTime,
+      ClimbSurfaceOffsetInterpSpeed * 90.f
+    );
+  }
+
+  ClimbSurfaceOffsetAlpha = FMath::FInterpConstantTo(ClimbSurfaceOffsetAlpha, bClimbCameraMode ? 1.f : 0.f, DeltaTime, ClimbSurfaceOffsetInterpSpeed);
+
+  // TargetOffset is in world space, which is what a surface normal offset needs
+  TargetOffset = WalkTargetOffset + ClimbSurfaceNormal * ClimbSurfaceOffset * FMath::SmoothStep(0.f, 1.f, ClimbSurfaceOffsetAlpha);
+
+  if (ClimbSurfaceOffsetAlpha <= 0.f)
+  {
+    TargetOffset = WalkTargetOffset;
+    ClimbSurfaceNormal = FVector::ZeroVector;
+  }
+}
+
+void UClimbSpringArmComponent::ProbeClimbArmLength()
+{
+  ClimbProbedArmLength = WalkTargetArmLength;
+
+  const FRotator DesiredRotation = GetTargetRotation();
+  const FVector ArmOrigin = GetComponentLocation() + TargetOffset;
+  const FVector DesiredCameraLocation = ArmOrigin
+    - DesiredRotation.Vector() * WalkTargetArmLength
+    + FRotationMatrix(DesiredRotation).TransformVector(SocketOffset);
+
+  static const FName ClimbSpringArmProbeName(TEXT("ClimbSpringArmProbe"));
+  FCollisionQueryParams QueryParams(ClimbSpringArmProbeName, false, GetOwner());
+
+  // The climbed surface is always right behind the arm origin, colliding with it is what made the camera jitter
+  if (MovementComponent)
+  {
+    TArray<const UPrimitiveComponent*> ClimbedComponents;
+    MovementComponent->GetClimbedComponents(ClimbedComponents);
+    for (const UPrimitiveComponent* ClimbedComponent : ClimbedComponents)
+    {
+      QueryParams.AddIgnoredComponent(ClimbedComponent);
+    }
+  }
+
+  FHitResult Hit;
+  const bool bHit = GetWorld()->SweepSingleByChannel(Hit, ArmOrigin, DesiredCameraLocation, FQuat::Identity,
+    ProbeChannel, FCollisionShape::MakeSphere(ProbeSize), QueryParams);
+
+  // No minimum length, anything longer than the hit puts the camera inside the geometry
+  bClimbProbeBlocked = bHit;
+  if (bHit)
+  {
+    ClimbProbedArmLength = WalkTargetArmLength * Hit.Time;
+  }
+}
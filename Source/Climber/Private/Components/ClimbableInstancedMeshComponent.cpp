@@ -0,0 +1,89 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Components/ClimbableInstancedMeshComponent.h"
+
+const FClimbInstanceData& UClimbableInstancedMeshComponent::GetInstanceClimbData(int32 InstanceIndex) const
+{
+  return PerInstanceClimbData.IsValidIndex(InstanceIndex) ? PerInstanceClimbData[InstanceIndex] : DefaultClimbData;
+}
+
+void UClimbableInstancedMeshComponent::SetInstanceClimbData(int32 InstanceIndex, const FClimbInstanceData& InClimbData)
+{
+  if (!IsValidInstance(InstanceIndex)) return;
+
+  while (PerInstanceClimbData.Num() <= InstanceIndex)
+  {
+    PerInstanceClimbData.Add(DefaultClimbData);
+  }
+
+  PerInstanceClimbData[InstanceIndex] = InClimbData;
+}
+
+const FClimbInstanceData* UClimbableInstancedMeshComponent::FindInstanceClimbData(const FHitResult& InHit)
+{
+  const UClimbableInstancedMeshComponent* InstancedMesh = Cast<UClimbableInstancedMeshComponent>(InHit.GetComponent());
+  if (!InstancedMesh) return nullptr;
+
+  // For instanced meshes the hit item is the instance index
+  return &InstancedMesh->GetInstanceClimbData(InHit.Item);
+}
+
+void UClimbableInstancedMeshComponent::PostInitProperties()
+{
+  Super::PostInitProperties();
+
+  if (!HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+  {
+    InstanceIndexUpdatedHandle = FInstancedStaticMeshDelegates::OnInstanceIndexUpdated.AddUObject(this, &UClimbableInstancedMeshComponent::OnInstanceIndexUpdated);
+  }
+}
+
+void UClimbableInstancedMeshComponent::BeginDestroy()
+{
+  FInstancedStaticMeshDelegates::OnInstanceIndexUpdated.Remove(InstanceIndexUpdatedHandle);
+
+  Super::BeginDestroy();
+}
+
+void UClimbableInstancedMeshComponent::OnInstanceIndexUpdated(UInstancedStaticMeshComponent* InComponent, TArrayView<const FInstancedStaticMeshDelegates::FInstanceIndexUpdateData> InIndexUpdates)
+{
+  if (InComponent != this || PerInstanceClimbData.IsEmpty()) return;
+
+  using EUpdateType = FInstancedStaticMeshDelegates::EInstanceIndexUpdateType;
+
+  // Relocations read the indices from before the update, so move from a copy
+  const TArray<FClimbInstanceData> OldClimbData = PerInstanceClimbData;
+
+  for (const FInstancedStaticMeshDelegates::FInstanceIndexUpdateData& IndexUpdate : InIndexUpdates)
+  {
+    switch (IndexUpdate.Type)
+    {
+    case EUpdateType::Added:
+      // Instances past the end already read the default
+      if (PerInstanceClimbData.IsValidIndex(IndexUpdate.Index))
+      {
+        PerInstanceClimbData[IndexUpdate.Index] = DefaultClimbData;
+      }
+      break;
+    case EUpdateType::Relocated:
+      if (PerInstanceClimbData.IsValidIndex(IndexUpdate.Index))
+      {
+        PerInstanceClimbData[IndexUpdate.Index] = OldClimbData.IsValidIndex(IndexUpdate.OldIndex) ? OldClimbData[IndexUpdate.OldIndex] : DefaultClimbData;
+      }
+      break;
+    case EUpdateType::Cleared:
+    case EUpdateType::Destroyed:
+      PerInstanceClimbData.Empty();
+      return;
+    default:
+      break;
+    }
+  }
+
+  // Removals shrink the instance array from the end once the survivors are relocated
+  if (PerInstanceClimbData.Num() > GetInstanceCount())
+  {
+    PerInstanceClimbData.SetNum(GetInstanceCount());
+  }
+}
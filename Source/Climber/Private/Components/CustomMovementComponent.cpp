@@ -5,10 +5,170 @@
 #include "Kismet/KismetSystemLibrary.h"
 #include "Climber/ClimberCharacter.h"
 #include "Climber/DebugHelper.h"
+#include "Climber/ClimbDebug.h"
 #include "Components/CapsuleComponent.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Climber/ClimberCharacter.h"
 #include "MotionWarpingComponent.h"
+#include "ClimbSolver.h"
+#include "ClimbSimulation.h"
+#include "Components/ClimbableInstancedMeshComponent.h"
+#include "UObject/UObjectIterator.h"
+#include "Engine/AssetManager.h"
+#include "DrawDebugHelpers.h"
+#include "ClimbAsyncCallback.h"
+#include "PBDRigidsSolver.h"
+#include "Physics/Experimental/PhysScene_Chaos.h"
+#include "Net/UnrealNetwork.h"
+#include "Subsystems/ClimbBatchSubsystem.h"
+#include "Subsystems/ClimbProbeBudgetSubsystem.h"
+#include "Subsystems/ClimbRegionSubsystem.h"
+#include "Data/ClimbProfile.h"
+
+DEFINE_LOG_CATEGORY(LogClimbing);
+LLM_DEFINE_TAG(Climbing);
+
+// Scene queries charged to the probe budget, roughly the traces each probe issues
+static constexpr int32 ToggleClimbingProbeCost = 4;
+static constexpr int32 HopCandidatesProbeCost = 4;
+static constexpr int32 MontagesPreloadProbeCost = 1;
+
+static FAutoConsoleCommandWithWorld ClimbMemReportCommand(
+  TEXT("Climber.MemReport"),
+  TEXT("Reports the climbing memory footprint of every climber in the world and the total."),
+  FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* InWorld)
+  {
+    SIZE_T TotalBytes = 0;
+    int32 NumClimbers = 0;
+
+    for (TObjectIterator<UCustomMovementComponent> It; It; ++It)
+    {
+      if (It->IsTemplate() || It->GetWorld() != InWorld) continue;
+
+      const SIZE_T ClimberBytes = It->GetClimbMemoryFootprint();
+      UE_LOG(LogClimbing, Log, TEXT("%s: %llu bytes"), *GetNameSafe(It->GetOwner()), (uint64)ClimberBytes);
+
+      TotalBytes += ClimberBytes;
+      NumClimbers++;
+    }
+
+    UE_LOG(LogClimbing, Log, TEXT("Total: %d climbers, %llu bytes"), NumClimbers, (uint64)TotalBytes);
+  })
+);
+
+static TAutoConsoleVariable<bool> CVarClimbAsyncProbes(
+  TEXT("Climber.AsyncProbes"),
+  true,
+  TEXT("Runs the per frame climb surface and floor probes in a tick function that can run on any thread, ahead of the movement tick.")
+);
+
+static TAutoConsoleVariable<bool> CVarClimbAsyncPhysics(
+  TEXT("Climber.AsyncPhysics"),
+  true,
+  TEXT("Runs the climb probes on the physics thread when async physics is enabled. Read when climbers begin play.")
+);
+
+static TAutoConsoleVariable<float> CVarClimbFixedStepRate(
+  TEXT("Climber.FixedStepRate"),
+  0.f,
+  TEXT("Steps climb velocity and rotation at this fixed rate in Hz instead of once per frame. 0 uses the frame delta time.")
+);
+
+static TAutoConsoleVariable<bool> CVarClimbRegionGating(
+  TEXT("Climber.RegionGating"),
+  true,
+  TEXT("Skips climb, ledge and vault probes for characters outside every climbable region, in worlds that have any.")
+);
+
+static TAutoConsoleVariable<float> CVarClimbAsyncPhysicsMaxDrift(
+  TEXT("Climber.AsyncPhysics.MaxDrift"),
+  5.f,
+  TEXT("How far a climber may have moved since its physics thread probes were traced before they are traced again on the game thread.")
+);
+
+void FClimbProbeTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+  if (Target && IsValidChecked(Target) && !Target->IsUnreachable())
+  {
+    Target->RunClimbProbes();
+  }
+}
+
+FString FClimbProbeTickFunction::DiagnosticMessage()
+{
+  return Target ? Target->GetFullName() + TEXT("[ClimbProbeTick]") : TEXT("<NULL>[ClimbProbeTick]");
+}
+
+FName FClimbProbeTickFunction::DiagnosticContext(bool bDetailed)
+{
+  return Target ? Target->GetClass()->GetFName() : NAME_None;
+}
+
+void FClimbReplicatedState::SetSurfaceNormal(const FVector& InNormal)
+{
+  for (int32 Axis = 0; Axis < 3; Axis++)
+  {
+    SurfaceNormal[Axis] = static_cast<int8>(FMath::Clamp(FMath::RoundToInt(InNormal[Axis] * 127.f), -127, 127));
+  }
+}
+
+FVector FClimbReplicatedState::GetSurfaceNormal() const
+{
+  return FVector(SurfaceNormal[0], SurfaceNormal[1], SurfaceNormal[2]).GetSafeNormal();
+}
+
+void FClimbReplicatedState::SetLocalVelocity(const FVector& InLocalVelocity)
+{
+  LocalVelocityY = static_cast<int16>(FMath::Clamp(FMath::RoundToInt(InLocalVelocity.Y), MIN_int16, MAX_int16));
+  LocalVelocityZ = static_cast<int16>(FMath::Clamp(FMath::RoundToInt(InLocalVelocity.Z), MIN_int16, MAX_int16));
+}
+
+FVector FClimbReplicatedState::GetLocalVelocity() const
+{
+  return FVector(0.f, LocalVelocityY, LocalVelocityZ);
+}
+
+bool FClimbReplicatedState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+  uint8 bClimbingBit = bClimbing;
+  Ar.SerializeBits(&bClimbingBit, 1);
+  bClimbing = bClimbingBit != 0;
+
+  Ar << TransitionId;
+
+  // Not climbing, nothing else is read by proxies
+  if (bClimbing)
+  {
+    Location.NetSerialize(Ar, Map, bOutSuccess);
+    Ar << SurfaceNormal[0] << SurfaceNormal[1] << SurfaceNormal[2];
+    Ar << LocalVelocityY << LocalVelocityZ;
+  }
+
+  bOutSuccess = true;
+  return true;
+}
+
+bool FClimbReplicatedState::operator==(const FClimbReplicatedState& Other) const
+{
+  return bClimbing == Other.bClimbing
+    && TransitionId == Other.TransitionId
+    && Location == Other.Location
+    && FMemory::Memcmp(SurfaceNormal, Other.SurfaceNormal, sizeof(SurfaceNormal)) == 0
+    && LocalVelocityY == Other.LocalVelocityY
+    && LocalVelocityZ == Other.LocalVelocityZ;
+}
+
+UCustomMovementComponent::UCustomMovementComponent()
+{
+  // Carries the compact climb state to simulated proxies
+  SetIsReplicatedByDefault(true);
+
+  // Only enabled while climbing, the movement tick waits for it
+  ClimbProbeTickFunction.bCanEverTick = true;
+  ClimbProbeTickFunction.bStartWithTickEnabled = false;
+  ClimbProbeTickFunction.bRunOnAnyThread = true;
+  ClimbProbeTickFunction.TickGroup = TG_PrePhysics;
+}
 
 #pragma region OverridenFunctions
 
@@ -16,6 +176,8 @@ void UCustomMovementComponent::BeginPlay()
 {
   Super::BeginPlay();
 
+  LLM_SCOPE_BYTAG(Climbing);
+
   OwningPlayerAnimInstance = CharacterOwner->GetMesh()->GetAnimInstance();
   if (OwningPlayerAnimInstance)
   {
@@ -24,11 +186,81 @@ void UCustomMovementComponent::BeginPlay()
   }
 
   OwningPlayerCharacter = Cast<AClimberCharacter>(CharacterOwner);
+
+  REDIRECT_OBJECT_TO_VLOG(this, GetOwner());
+
+  RegisterClimbAsyncCallback();
+
+  if (UClimbBatchSubsystem* ClimbBatchSubsystem = GetWorld()->GetSubsystem<UClimbBatchSubsystem>())
+  {
+    ClimbBatchSubsystem->RegisterClimber(this);
+  }
+
+#if WITH_EDITOR
+  ClimbProfileChangedHandle = UClimbProfile::OnClimbProfileChanged.AddUObject(this, &ThisClass::OnClimbProfileChanged);
+#endif
+}
+
+void UCustomMovementComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+  Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+  // Owners predict their own climbing
+  DOREPLIFETIME_CONDITION(UCustomMovementComponent, ClimbReplicatedState, COND_SimulatedOnly);
+}
+
+void UCustomMovementComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+  UnregisterClimbAsyncCallback();
+
+#if WITH_EDITOR
+  UClimbProfile::OnClimbProfileChanged.Remove(ClimbProfileChangedHandle);
+#endif
+
+  if (UClimbBatchSubsystem* ClimbBatchSubsystem = GetWorld()->GetSubsystem<UClimbBatchSubsystem>())
+  {
+    ClimbBatchSubsystem->UnregisterClimber(this);
+  }
+
+  Super::EndPlay(EndPlayReason);
 }
 
 void UCustomMovementComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
   Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+  // Only the climb bookkeeping below, walking and falling allocations stay with the rest of character movement
+  LLM_SCOPE_BYTAG(Climbing);
+
+  // The mesh ticks after this one (ACharacter::PostInitializeComponents), root motion poses tick earlier, see TickCharacterPose
+  PublishClimbAnimSnapshot();
+
+  UpdateClimbMontagesPreload(DeltaTime);
+
+  if (GetOwnerRole() == ROLE_Authority && GetNetMode() != NM_Standalone)
+  {
+    UpdateClimbReplicatedState();
+    UpdateClimbMovementReplication();
+    UpdateClimbNetIdle(DeltaTime);
+  }
+}
+
+void UCustomMovementComponent::RegisterComponentTickFunctions(bool bRegister)
+{
+  Super::RegisterComponentTickFunctions(bRegister);
+
+  if (bRegister)
+  {
+    if (SetupActorComponentTickFunction(&ClimbProbeTickFunction))
+    {
+      ClimbProbeTickFunction.Target = this;
+      PrimaryComponentTick.AddPrerequisite(this, ClimbProbeTickFunction);
+    }
+  }
+  else if (ClimbProbeTickFunction.IsTickFunctionRegistered())
+  {
+    ClimbProbeTickFunction.UnRegisterTickFunction();
+  }
 }
 
 void UCustomMovementComponent::OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode)
@@ -36,21 +268,33 @@ void UCustomMovementComponent::OnMovementModeChanged(EMovementMode PreviousMovem
   if (IsClimbing())
   {
     bOrientRotationToMovement = false;
-    CharacterOwner->GetCapsuleComponent()->SetCapsuleHalfHeight(48.0f);
+    CharacterOwner->GetCapsuleComponent()->SetCapsuleHalfHeight(GetClimbProfile().ClimbCapsuleHalfHeight);
+    bHopCandidatesDirty = true;
+    ClimbProbeTickFunction.SetTickFunctionEnable(ClimbAsyncCallback == nullptr);
 
+    CLIMB_VLOG(this, TEXT("Enter climb state"));
     OnEnterClimbStateDelegate.ExecuteIfBound();
   }
 
   if (PreviousMovementMode == MOVE_Custom && PreviousCustomMode == ECustomMovementMode::MOVE_Climb)
   {
     bOrientRotationToMovement = true;
-    CharacterOwner->GetCapsuleComponent()->SetCapsuleHalfHeight(96.0f);
+    CharacterOwner->GetCapsuleComponent()->SetCapsuleHalfHeight(GetClimbProfile().WalkCapsuleHalfHeight);
+    ClimbSurfaceCache.Empty();
+    ClimbProbeTickFunction.SetTickFunctionEnable(false);
+    bCornerWrapping = false;
+    bHasClimbProbeSnapshot = false;
+    ClimbProbeResults.bValid = false;
+    BatchedClimbSolve.bValid = false;
+    ClimbFixedStepper.Reset();
+    SendClimbAsyncInput(false);
 
     const FRotator DirtyRotation = UpdatedComponent->GetComponentRotation();
     const FRotator CleanStandRotation = FRotator(0.0f, DirtyRotation.Yaw, 0.0f);
     UpdatedComponent->SetRelativeRotation(CleanStandRotation);
     StopMovementImmediately();
 
+    CLIMB_VLOG(this, TEXT("Exit climb state to %s"), *GetMovementName());
     OnExitClimbStateDelegate.ExecuteIfBound();
   }
 
@@ -71,7 +315,7 @@ float UCustomMovementComponent::GetMaxSpeed() const
 {
   if (IsClimbing())
   {
-    return MaxClimbSpeed;
+    return GetClimbProfile().MaxClimbSpeed * CurrentClimbableSurfaceProperties.SpeedScale;
   }
   else
   {
@@ -83,7 +327,7 @@ float UCustomMovementComponent::GetMaxAcceleration() const
 {
   if (IsClimbing())
   {
-    return MaxClimbAcceleration;
+    return GetClimbProfile().MaxClimbAcceleration * CurrentClimbableSurfaceProperties.AccelerationScale;
   }
   else
   {
@@ -91,6 +335,19 @@ float UCustomMovementComponent::GetMaxAcceleration() const
   }
 }
 
+FVector UCustomMovementComponent::ScaleInputAcceleration(const FVector& InputAcceleration) const
+{
+  const FVector ScaledAcceleration = Super::ScaleInputAcceleration(InputAcceleration);
+  if (!IsClimbing() || ClimbSeparationVelocity.IsZero()) return ScaledAcceleration;
+
+  // Separation steers like move input, so it is part of the saved move the server replays instead of a correction it never sees
+  const float MaxSeparationSpeed = GetClimbProfile().MaxClimbSeparationSpeed;
+  if (MaxSeparationSpeed <= 0.f) return ScaledAcceleration;
+
+  const FVector SeparationAcceleration = ClimbSeparationVelocity / MaxSeparationSpeed * GetMaxAcceleration();
+  return (ScaledAcceleration + SeparationAcceleration).GetClampedToMaxSize(GetMaxAcceleration());
+}
+
 FVector UCustomMovementComponent::ConstrainAnimRootMotionVelocity(const FVector& RootMotionVelocity, const FVector& CurrentVelocity) const
 {
   const bool bIsPlayingRMMontage =
@@ -106,12 +363,83 @@ FVector UCustomMovementComponent::ConstrainAnimRootMotionVelocity(const FVector&
   }
 }
 
+void UCustomMovementComponent::TickCharacterPose(float DeltaTime)
+{
+  // Root motion montages tick the pose inside PerformMovement, before TickComponent publishes, so publish for it here
+  PublishClimbAnimSnapshot(false);
+
+  Super::TickCharacterPose(DeltaTime);
+}
+
 #pragma endregion
 
 #pragma region ClimbTraces
 
-TArray<FHitResult> UCustomMovementComponent::DoCapsuleTraceMultiByObject(const FVector& Start, const FVector& End, bool bShowDebugShape, bool bDrawPersistentShapes)
+TArray<FHitResult> UCustomMovementComponent::DoCapsuleTraceMulti(const FVector& Start, const FVector& End, EClimbTraceTarget InTarget, bool bShowDebugShape, bool bDrawPersistentShapes) const
+{
+  const UClimbProfile& Profile = GetClimbProfile();
+
+  bShowDebugShape |= ClimbDebug::ShouldDrawTraces();
+
+  const FCollisionShape CapsuleShape = FCollisionShape::MakeCapsule(Profile.ClimbCapsuleTraceRadius, Profile.ClimbCapsuleTraceHalfHeight);
+
+  // Climb surface properties come from the physical material of each hit
+  FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ClimbCapsuleTrace), false);
+  QueryParams.bReturnPhysicalMaterial = InTarget == EClimbTraceTarget::ClimbableSurfaces;
+
+  TArray<FHitResult> OutCapsuleTraceHitResults;
+  if (InTarget == EClimbTraceTarget::ClimbableSurfaces)
+  {
+    // Climbable geometry blocks the channel, downgrade it to touches so the sweep
+    // reports every climbable surface in range instead of stopping at the first one
+    const FCollisionResponseParams ResponseParams(ECR_Overlap);
+
+    GetWorld()->SweepMultiByChannel(
+      OutCapsuleTraceHitResults,
+      Start,
+      End,
+      FQuat::Identity,
+      Profile.ClimbableTraceChannel,
+      CapsuleShape,
+      QueryParams,
+      ResponseParams
+    );
+  }
+  else
+  {
+    GetWorld()->SweepMultiByObjectType(
+      OutCapsuleTraceHitResults,
+      Start,
+      End,
+      FQuat::Identity,
+      FCollisionObjectQueryParams(Profile.WorldTraceObjectType),
+      CapsuleShape,
+      QueryParams
+    );
+  }
+
+  CLIMB_VLOG_CAPSULE(this, End, Profile.ClimbCapsuleTraceHalfHeight, Profile.ClimbCapsuleTraceRadius,
+    OutCapsuleTraceHitResults.IsEmpty() ? FColor::Red : FColor::Green, TEXT("Capsule trace, %d hits"), OutCapsuleTraceHitResults.Num());
+
+  if (bShowDebugShape)
+  {
+    const float LifeTime = bDrawPersistentShapes ? -1.f : 0.f;
+    const FColor TraceColor = OutCapsuleTraceHitResults.IsEmpty() ? FColor::Red : FColor::Green;
+    DrawDebugCapsule(GetWorld(), End, Profile.ClimbCapsuleTraceHalfHeight, Profile.ClimbCapsuleTraceRadius, FQuat::Identity, TraceColor, bDrawPersistentShapes, LifeTime);
+
+    for (const FHitResult& CapsuleTraceHit : OutCapsuleTraceHitResults)
+    {
+      DrawDebugPoint(GetWorld(), CapsuleTraceHit.ImpactPoint, 10.f, FColor::Green, bDrawPersistentShapes, LifeTime);
+    }
+  }
+
+  return OutCapsuleTraceHitResults;
+}
+
+FHitResult UCustomMovementComponent::DoLineTraceSingle(const FVector& Start, const FVector& End, EClimbTraceTarget InTarget, bool bShowDebugShape, bool bDrawPersistentShapes) const
 {
+  bShowDebugShape |= ClimbDebug::ShouldDrawTraces();
+
   EDrawDebugTrace::Type DebugTraceType = EDrawDebugTrace::None;
   if (bShowDebugShape)
   {
@@ -122,26 +450,42 @@ TArray<FHitResult> UCustomMovementComponent::DoCapsuleTraceMultiByObject(const F
     }
   }
 
-  TArray<FHitResult> OutCapsuleTraceHitResults;
-  UKismetSystemLibrary::CapsuleTraceMultiForObjects(
-    this,
-    Start,
-    End,
-    ClimbCapsuleTraceRadius,
-    ClimbCapsuleTraceHalfHeight,
-    ClimbableSurfaceTraceTypes,
-    false,
-    TArray<AActor*>(),
-    DebugTraceType,
-    OutCapsuleTraceHitResults,
-    false
-  );
+  FHitResult OutHit;
+  if (InTarget == EClimbTraceTarget::ClimbableSurfaces)
+  {
+    UKismetSystemLibrary::LineTraceSingle(this,
+      Start,
+      End,
+      UEngineTypes::ConvertToTraceType(GetClimbProfile().ClimbableTraceChannel),
+      false,
+      TArray<AActor*>(),
+      DebugTraceType,
+      OutHit,
+      false);
+  }
+  else
+  {
+    UKismetSystemLibrary::LineTraceSingleForObjects(this,
+      Start,
+      End,
+      GetWorldTraceObjectTypes(),
+      false,
+      TArray<AActor*>(),
+      DebugTraceType,
+      OutHit,
+      false);
+  }
 
-  return OutCapsuleTraceHitResults;
+  CLIMB_VLOG_SEGMENT(this, Start, OutHit.bBlockingHit ? OutHit.ImpactPoint : End,
+    OutHit.bBlockingHit ? FColor::Green : FColor::Red, TEXT("Line trace"));
+
+  return OutHit;
 }
 
-FHitResult UCustomMovementComponent::DoLineTraceSingleByObject(const FVector& Start, const FVector& End, bool bShowDebugShape, bool bDrawPersistentShapes)
+FHitResult UCustomMovementComponent::DoSphereTraceSingle(const FVector& Start, const FVector& End, float Radius, EClimbTraceTarget InTarget, bool bShowDebugShape, bool bDrawPersistentShapes) const
 {
+  bShowDebugShape |= ClimbDebug::ShouldDrawTraces();
+
   EDrawDebugTrace::Type DebugTraceType = EDrawDebugTrace::None;
   if (bShowDebugShape)
   {
@@ -153,18 +497,44 @@ FHitResult UCustomMovementComponent::DoLineTraceSingleByObject(const FVector& St
   }
 
   FHitResult OutHit;
-  UKismetSystemLibrary::LineTraceSingleForObjects(this,
-    Start,
-    End,
-    ClimbableSurfaceTraceTypes,
-    false,
-    TArray<AActor*>(),
-    DebugTraceType,
-    OutHit,
-    false);
+  if (InTarget == EClimbTraceTarget::ClimbableSurfaces)
+  {
+    UKismetSystemLibrary::SphereTraceSingle(this,
+      Start,
+      End,
+      Radius,
+      UEngineTypes::ConvertToTraceType(GetClimbProfile().ClimbableTraceChannel),
+      false,
+      TArray<AActor*>(),
+      DebugTraceType,
+      OutHit,
+      false);
+  }
+  else
+  {
+    UKismetSystemLibrary::SphereTraceSingleForObjects(this,
+      Start,
+      End,
+      Radius,
+      GetWorldTraceObjectTypes(),
+      false,
+      TArray<AActor*>(),
+      DebugTraceType,
+      OutHit,
+      false);
+  }
+
+  CLIMB_VLOG_SEGMENT(this, Start, OutHit.bBlockingHit ? OutHit.Location : End,
+    OutHit.bBlockingHit ? FColor::Green : FColor::Red, TEXT("Sphere trace, radius %.0f"), Radius);
+
   return OutHit;
 }
 
+TArray<TEnumAsByte<EObjectTypeQuery>> UCustomMovementComponent::GetWorldTraceObjectTypes() const
+{
+  return { UEngineTypes::ConvertToObjectType(GetClimbProfile().WorldTraceObjectType) };
+}
+
 #pragma endregion
 
 #pragma region ClimbCore
@@ -173,18 +543,39 @@ void UCustomMovementComponent::ToggleClimbing(bool bEnableClimb)
 {
   if (bEnableClimb)
   {
-    if (CanStartClimbing())
+    if (IsFalling()) return;
+
+    // Nothing to climb, ledge down or vault over out here
+    if (!IsClimbCandidate())
     {
-      // Enter climb state
-      PlayClimbMontage(IdleToClimbMontage);
+      CLIMB_VLOG(this, TEXT("Toggle climbing: outside every climbable region"));
+      return;
     }
-    else if (CanClimbDownLedge())
+
+    // Input driven probes come in bursts, AI climbers simply try again on their next attempt when deferred
+    const bool bProbed = UClimbProbeBudgetSubsystem::RunProbe(this, ToggleClimbingProbeCost, [this]()
     {
-      PlayClimbMontage(ClimbDownLedgeMontage);
-    }
-    else
+      if (CanStartClimbing())
+      {
+        // Enter climb state
+        CLIMB_VLOG(this, TEXT("Toggle climbing: start climbing"));
+        PlayClimbMontage(EClimbTransition::IdleToClimb);
+      }
+      else if (CanClimbDownLedge(GetProbeFrame()))
+      {
+        CLIMB_VLOG(this, TEXT("Toggle climbing: climb down ledge"));
+        PlayClimbMontage(EClimbTransition::ClimbDownLedge);
+      }
+      else
+      {
+        CLIMB_VLOG(this, TEXT("Toggle climbing: fell through to vaulting"));
+        TryStartVaulting();
+      }
+    });
+
+    if (!bProbed)
     {
-      TryStartVaulting();
+      CLIMB_VLOG(this, TEXT("Toggle climbing: deferred by the probe budget"));
     }
   }
   else
@@ -199,85 +590,110 @@ void UCustomMovementComponent::TryStartVaulting()
   FVector VaultStartPosition;
   FVector VaultLandPosition;
 
-  if (CanStartVaulting(VaultStartPosition, VaultLandPosition))
+  if (CanStartVaulting(GetProbeFrame(), VaultStartPosition, VaultLandPosition))
   {
     SetMotionWarpTarget(FName("VaultStartPoint"), VaultStartPosition);
     SetMotionWarpTarget(FName("VaultEndPoint"), VaultLandPosition);
 
     StartClimbing();
-    PlayClimbMontage(VaultMontage);
+    PlayClimbMontage(EClimbTransition::Vault);
   }
 }
 
-bool UCustomMovementComponent::CanStartVaulting(FVector& OutVaultStartPosition, FVector& OutVaultLandPosition)
+bool UCustomMovementComponent::CanStartVaulting(const FClimbProbeFrame& InFrame, FVector& OutVaultStartPosition, FVector& OutVaultLandPosition) const
 {
-  if (IsFalling()) return false;
+  const UClimbProfile& Profile = GetClimbProfile();
 
   OutVaultStartPosition = FVector::ZeroVector;
   OutVaultLandPosition = FVector::ZeroVector;
 
-  const FVector ComponentLocation = UpdatedComponent->GetComponentLocation();
-  const FVector ComponentForward = UpdatedComponent->GetForwardVector();
-  const FVector UpVector = UpdatedComponent->GetUpVector();
-  const FVector DownVector = -UpdatedComponent->GetUpVector();
+  const FVector ComponentLocation = InFrame.Location;
+  const FVector ComponentForward = InFrame.GetForwardVector();
+  const FVector UpVector = InFrame.GetUpVector();
+  const FVector DownVector = -InFrame.GetUpVector();
 
-  for (int32 i = 0; i < 5; i++)
-  {
-    const FVector Start = ComponentLocation + UpVector * 100.f +
-      ComponentForward * 80.f * (i + 1);
+  // Start probe, the top of the obstacle right in front of the character
+  const FVector StartProbeStart = ComponentLocation + UpVector * Profile.VaultProbeHeight + ComponentForward * Profile.VaultProbeSpacing;
+  const FVector StartProbeEnd = StartProbeStart + DownVector * Profile.VaultProbeHeight;
 
-    const FVector End = Start + DownVector * 100.f * (i + 1);
+  const FHitResult VaultStartHit = DoLineTraceSingle(StartProbeStart, StartProbeEnd, EClimbTraceTarget::World);
+  if (!VaultStartHit.bBlockingHit || VaultStartHit.bStartPenetrating) return false;
 
-    FHitResult VaultTraceHit = DoLineTraceSingleByObject(Start, End);
+  const FClimbInstanceData* InstanceClimbData = UClimbableInstancedMeshComponent::FindInstanceClimbData(VaultStartHit);
+  if (InstanceClimbData && !InstanceClimbData->bVaultTarget) return false;
 
-    if (i == 0 && VaultTraceHit.bBlockingHit)
-    {
-      OutVaultStartPosition = VaultTraceHit.ImpactPoint;
-    }
+  const FVector FeetLocation = ComponentLocation + DownVector * InFrame.CapsuleHalfHeight;
+  const float ObstacleHeight = FVector::DotProduct(VaultStartHit.ImpactPoint - FeetLocation, UpVector);
+  if (ObstacleHeight > Profile.MaxVaultObstacleHeight) return false;
 
-    if (i == 3 && VaultTraceHit.bBlockingHit)
-    {
-      OutVaultLandPosition = VaultTraceHit.ImpactPoint;
-    }
-  }
+  // Clearance sweep, straight across the obstacle top at the height the vault montage clears it by.
+  // Two line probes alone would let the climber vault into a wall standing on the obstacle, so this third query stays
+  const FVector ClearanceSweepStart = VaultStartHit.ImpactPoint + UpVector * Profile.VaultClearanceRadius * 2.f;
+  const FVector ClearanceSweepEnd = ClearanceSweepStart + ComponentForward * Profile.VaultProbeSpacing * 3.f;
 
-  if (OutVaultStartPosition != FVector::ZeroVector && OutVaultLandPosition != FVector::ZeroVector)
-  {
-    return true;
-  }
-  else
-  {
-    return false;
-  }
+  const FHitResult ClearanceSweepHit = DoSphereTraceSingle(ClearanceSweepStart, ClearanceSweepEnd, Profile.VaultClearanceRadius, EClimbTraceTarget::World);
+  if (ClearanceSweepHit.bBlockingHit) return false;
+
+  // Landing probe, down from the end of the clearance sweep
+  const float LandProbeLength = FVector::DotProduct(ClearanceSweepEnd - ComponentLocation, UpVector) + Profile.VaultLandProbeDepth;
+  const FHitResult VaultLandHit = DoLineTraceSingle(ClearanceSweepEnd, ClearanceSweepEnd + DownVector * LandProbeLength, EClimbTraceTarget::World);
+  if (!VaultLandHit.bBlockingHit) return false;
+
+  // Landing at the obstacle top height means it is too thick to vault over
+  const float LandDropHeight = FVector::DotProduct(VaultStartHit.ImpactPoint - VaultLandHit.ImpactPoint, UpVector);
+  if (LandDropHeight < Profile.MinVaultDropHeight) return false;
 
+  OutVaultStartPosition = VaultStartHit.ImpactPoint;
+  OutVaultLandPosition = VaultLandHit.ImpactPoint;
+
+  return true;
 }
 
 bool UCustomMovementComponent::CanStartClimbing()
 {
-  if (IsFalling()) return false;
   if (!TraceClimbableSurfaces()) return false;
-  if (!TraceFromEyeHeight(100.0f).bBlockingHit) return false;
+  if (!TraceFromEyeHeight(GetProbeFrame(), GetClimbProfile().EyeHeightTraceDistance).bBlockingHit) return false;
 
   return true;
 }
 
-bool UCustomMovementComponent::CanClimbDownLedge()
+bool UCustomMovementComponent::HasClimbableSurface(const FClimbProbeFrame& InFrame) const
 {
-  if (IsFalling()) return false;
+  TArray<FHitResult> SurfaceHits;
+  FVector TraceOrigin;
+  if (!SweepClimbableSurfaces(InFrame, SurfaceHits, TraceOrigin)) return false;
 
-  const FVector ComponentLocation = UpdatedComponent->GetComponentLocation();
-  const FVector ComponentForward = UpdatedComponent->GetForwardVector();
-  const FVector DownVector = -UpdatedComponent->GetUpVector();
+  const bool bAnyClimbableHit = SurfaceHits.ContainsByPredicate([](const FHitResult& SurfaceHit)
+    {
+      return ResolveHitSurface(SurfaceHit).bClimbable;
+    });
+
+  if (!bAnyClimbableHit) return false;
+  if (!TraceFromEyeHeight(InFrame, GetClimbProfile().EyeHeightTraceDistance).bBlockingHit) return false;
+
+  return true;
+}
+
+bool UCustomMovementComponent::CanClimbDownLedge(const FClimbProbeFrame& InFrame) const
+{
+  const UClimbProfile& Profile = GetClimbProfile();
+
+  const FVector ComponentLocation = InFrame.Location;
+  const FVector ComponentForward = InFrame.GetForwardVector();
+  const FVector DownVector = -InFrame.GetUpVector();
 
-  const FVector WalkableSurfaceTraceStart = ComponentLocation + ComponentForward * ClimbDownWalkableSurfaceTraceOffset;
-  const FVector WalkableSurfaceTraceEnd = WalkableSurfaceTraceStart + DownVector * 100.f;
+  const FVector WalkableSurfaceTraceStart = ComponentLocation + ComponentForward * Profile.ClimbDownWalkableSurfaceTraceOffset;
+  const FVector WalkableSurfaceTraceEnd = WalkableSurfaceTraceStart + DownVector * Profile.ClimbDownWalkableSurfaceTraceLength;
 
-  FHitResult WalkableSurfaceHit = DoLineTraceSingleByObject(WalkableSurfaceTraceStart, WalkableSurfaceTraceEnd);
+  FHitResult WalkableSurfaceHit = DoLineTraceSingle(WalkableSurfaceTraceStart, WalkableSurfaceTraceEnd, EClimbTraceTarget::World);
 
-  const FVector LedgeTraceStart = WalkableSurfaceHit.TraceStart + ComponentForward * ClimbDownLedgeTraceOffset;
-  const FVector LedgeTraceEnd = LedgeTraceStart + DownVector * 200.f;
+  const FVector LedgeTraceStart = WalkableSurfaceHit.TraceStart + ComponentForward * Profile.ClimbDownLedgeTraceOffset;
+  const FVector LedgeTraceEnd = LedgeTraceStart + DownVector * Profile.ClimbDownLedgeTraceLength;
 
-  FHitResult LedgeTraceHit = DoLineTraceSingleByObject(LedgeTraceStart, LedgeTraceEnd);
+  FHitResult LedgeTraceHit = DoLineTraceSingle(LedgeTraceStart, LedgeTraceEnd, EClimbTraceTarget::World);
+
+  const FClimbInstanceData* InstanceClimbData = UClimbableInstancedMeshComponent::FindInstanceClimbData(WalkableSurfaceHit);
+  if (InstanceClimbData && !InstanceClimbData->bLedge) return false;
 
   if (WalkableSurfaceHit.bBlockingHit && !LedgeTraceHit.bBlockingHit)
   {
@@ -304,32 +720,93 @@ void UCustomMovementComponent::PhysClimb(float deltaTime, int32 Iterations)
     return;
   }
 
+  LLM_SCOPE_BYTAG(Climbing);
+
+  const UClimbProfile& Profile = GetClimbProfile();
+
+  ConsumeClimbAsyncOutputs();
+
+  // The batch tick already stored the contacts from these probe results and solved them
+  BatchedClimbSolve.bValid = BatchedClimbSolve.bValid && HasCurrentClimbProbeResults();
+
   /*Process all the climbable surfaces info*/
-  TraceClimbableSurfaces();
+  if (!BatchedClimbSolve.bValid)
+  {
+    TraceClimbableSurfaces();
+  }
   ProcessClimbableSurfaceInfo();
+  TryStartCornerWrap();
+
+  /*Check if we should stop climbing, never halfway around a corner*/
+  const bool bShouldStopClimbing = !bCornerWrapping && (CheckShouldStopClimbing() || CheckHasReachedFloor());
 
-  /*Check if we should stop climbing*/
-  if (CheckShouldStopClimbing() || CheckHasReachedFloor())
+  // Probe results are only good for the first iteration, later ones move the character before tracing
+  ClimbProbeResults.bValid = false;
+
+  if (bShouldStopClimbing)
   {
     StopClimbing();
   }
 
   RestorePreAdditiveRootMotionVelocity();
 
-  if (!HasAnimRootMotion() && !CurrentRootMotion.HasOverrideVelocity())
+  // Transitions are driven by montage root motion, which keeps the variable step
+  const float FixedStepRate = CVarClimbFixedStepRate.GetValueOnGameThread();
+  const bool bFixedStep = FixedStepRate > 0.f && !HasAnimRootMotion() && !CurrentRootMotion.HasOverrideVelocity();
+
+  FVector OldLocation = UpdatedComponent->GetComponentLocation();
+  FVector Adjusted;
+  FQuat ClimbRotation;
+  float SteppedTime = deltaTime;
+
+  if (bFixedStep)
   {
-    //Define the max climb speed and acceleration
-    CalcVelocity(deltaTime, 0.0f, true, MaxBreakCLimbDeceleration);
+    FClimbSimState SimState;
+    SimState.Location = OldLocation;
+    SimState.Rotation = UpdatedComponent->GetComponentQuat();
+    SimState.Velocity = Velocity;
+
+    FClimbSimInput SimInput;
+    SimInput.Acceleration = Acceleration;
+    SimInput.Surface.Location = CurrentClimbableSurfaceLocation;
+    SimInput.Surface.Normal = CurrentClimbableSurfaceNormal;
+
+    FClimbSimParams SimParams;
+    SimParams.MaxSpeed = GetMaxSpeed();
+    SimParams.BrakingDeceleration = Profile.MaxBrakeClimbDeceleration * CurrentClimbableSurfaceProperties.Grip;
+    SimParams.RotationInterpSpeed = Profile.ClimbRotationInterpSpeed;
+
+    // Frames between whole steps show a partial step instead of standing still
+    SimState = ClimbSimulation::StepFrame(ClimbFixedStepper, SimState, SimInput, SimParams, deltaTime, 1.f / FixedStepRate, SteppedTime);
+
+    Velocity = SimState.Velocity;
+    Adjusted = SimState.Location - OldLocation;
+    ClimbRotation = SimState.Rotation;
+  }
+  else
+  {
+    // Whatever partial step was presented becomes part of the variable step state
+    ClimbFixedStepper.Reset();
+
+    if (!HasAnimRootMotion() && !CurrentRootMotion.HasOverrideVelocity())
+    {
+      //Define the max climb speed and acceleration
+      CalcVelocity(deltaTime, 0.0f, true, Profile.MaxBrakeClimbDeceleration * CurrentClimbableSurfaceProperties.Grip);
+    }
+
+    ApplyRootMotionToVelocity(deltaTime);
+
+    Adjusted = Velocity * deltaTime;
+    //Handle climb rotation
+    ClimbRotation = GetClimbRotation(deltaTime);
   }
 
-  ApplyRootMotionToVelocity(deltaTime);
+  // Consumed through this move's acceleration, see ScaleInputAcceleration
+  ClimbSeparationVelocity = FVector::ZeroVector;
 
-  FVector OldLocation = UpdatedComponent->GetComponentLocation();
-  const FVector Adjusted = Velocity * deltaTime;
   FHitResult Hit(1.f);
-
-  //Handle climb rotation
-  SafeMoveUpdatedComponent(Adjusted, GetClimbRotation(deltaTime), true, Hit);
+  SafeMoveUpdatedComponent(Adjusted, ClimbRotation, true, Hit);
+  BatchedClimbSolve.bValid = false;
 
   if (Hit.Time < 1.f)
   {
@@ -338,169 +815,616 @@ void UCustomMovementComponent::PhysClimb(float deltaTime, int32 Iterations)
     SlideAlongSurface(Adjusted, (1.f - Hit.Time), Hit.Normal, Hit, true);
   }
 
-  if (!HasAnimRootMotion() && !CurrentRootMotion.HasOverrideVelocity())
+  // A hitch dropped past MaxStepsPerFrame can leave no stepped time, keep the last stepped velocity then
+  if (!HasAnimRootMotion() && !CurrentRootMotion.HasOverrideVelocity() && SteppedTime > 0.f)
   {
-    Velocity = (UpdatedComponent->GetComponentLocation() - OldLocation) / deltaTime;
+    Velocity = (UpdatedComponent->GetComponentLocation() - OldLocation) / SteppedTime;
   }
 
-  /*Snap movement to climbable surfaces*/
-  SnapMovementToClimbableSurfaces(deltaTime);
+  /*Snap movement to climbable surfaces, the corner wrap warp places the climber itself*/
+  if (!bCornerWrapping)
+  {
+    SnapMovementToClimbableSurfaces(deltaTime);
+  }
 
   if (CheckHasReachedLedge())
   {
-    PlayClimbMontage(ClimbToTopMontage);
+    PlayClimbMontage(EClimbTransition::ClimbToTop);
+  }
+
+  RefreshHopCandidates(deltaTime);
+
+  // Next frame probes trace from here, on the probe tick
+  if (IsClimbing())
+  {
+    ClimbProbeSnapshot = GetProbeFrame();
+    bHasClimbProbeSnapshot = true;
+    SendClimbAsyncInput(true);
   }
 }
 
 void UCustomMovementComponent::ProcessClimbableSurfaceInfo()
 {
-  CurrentClimbableSurfaceLocation = FVector::ZeroVector;
-  CurrentClimbableSurfaceNormal = FVector::ZeroVector;
+  const FClimbSurface ClimbSurface = BatchedClimbSolve.bValid
+    ? FClimbSurface{ BatchedClimbSolve.Location, BatchedClimbSolve.Normal }
+    : ClimbSolver::ReduceContacts(ClimbContacts, ClimbContactsOrigin);
+  CurrentClimbableSurfaceLocation = ClimbSurface.Location;
+  CurrentClimbableSurfaceNormal = ClimbSurface.Normal;
+
+#if CLIMB_DEBUG_ENABLED
+  if (ClimbDebug::IsRecording())
+  {
+    for (const FClimbContact& Contact : ClimbContacts)
+    {
+      const FVector ContactPoint = Contact.GetPoint(ClimbContactsOrigin);
+      CLIMB_VLOG_ARROW(this, ContactPoint, ContactPoint + Contact.GetNormal() * 30.f, FColor::Cyan, TEXT(""));
+    }
+
+    CLIMB_VLOG_ARROW(this, CurrentClimbableSurfaceLocation, CurrentClimbableSurfaceLocation + CurrentClimbableSurfaceNormal * 60.f,
+      FColor::Blue, TEXT("Surface normal, %d contacts"), ClimbContacts.Num());
+  }
+#endif
+  CurrentClimbableSurfaceProperties = FClimbSurfaceProperties();
 
-  if (ClimbableSurfacesTracedResults.IsEmpty()) return;
+  if (ClimbContacts.IsEmpty()) return;
 
-  for (const FHitResult& TracedHitResult : ClimbableSurfacesTracedResults)
+  FClimbSurfaceProperties SurfacePropertiesSum;
+  SurfacePropertiesSum.Grip = 0.f;
+  SurfacePropertiesSum.SpeedScale = 0.f;
+  SurfacePropertiesSum.AccelerationScale = 0.f;
+
+  for (const FClimbContact& Contact : ClimbContacts)
   {
-    CurrentClimbableSurfaceLocation += TracedHitResult.ImpactPoint;
-    CurrentClimbableSurfaceNormal += TracedHitResult.ImpactNormal;
+    const FClimbSurfaceProperties& ContactSurface = ClimbContactComponents[Contact.ComponentIndex].Surface;
+    SurfacePropertiesSum.Grip += ContactSurface.Grip;
+    SurfacePropertiesSum.SpeedScale += ContactSurface.SpeedScale;
+    SurfacePropertiesSum.AccelerationScale += ContactSurface.AccelerationScale;
   }
-  CurrentClimbableSurfaceLocation /= ClimbableSurfacesTracedResults.Num();
-  CurrentClimbableSurfaceNormal = CurrentClimbableSurfaceNormal.GetSafeNormal();
+
+  CurrentClimbableSurfaceProperties.Grip = SurfacePropertiesSum.Grip / ClimbContacts.Num();
+  CurrentClimbableSurfaceProperties.SpeedScale = SurfacePropertiesSum.SpeedScale / ClimbContacts.Num();
+  CurrentClimbableSurfaceProperties.AccelerationScale = SurfacePropertiesSum.AccelerationScale / ClimbContacts.Num();
 }
 
 bool UCustomMovementComponent::CheckShouldStopClimbing()
 {
-  if (ClimbableSurfacesTracedResults.IsEmpty()) return true;
+  if (BatchedClimbSolve.bValid) return BatchedClimbSolve.bShouldStop;
+
+  if (ClimbContacts.IsEmpty()) return true;
+
+  return ClimbSolver::ShouldStopClimbing(CurrentClimbableSurfaceNormal, GetClimbProfile().StopClimbingAngle);
+}
+
+bool UCustomMovementComponent::CheckHasReachedFloor()
+{
+  if (BatchedClimbSolve.bValid) return BatchedClimbSolve.bFloorReached;
 
-  const float DotResult = FVector::DotProduct(CurrentClimbableSurfaceNormal, FVector::UpVector);
-  const float DegreeDiff = FMath::RadiansToDegrees(FMath::Acos(DotResult));
+  float FloorNormalZ = ClimbProbeResults.FloorNormalZ;
 
-  if (DegreeDiff <= 60.0f)
+  if (!HasCurrentClimbProbeResults())
   {
-    return true;
+    TArray<FHitResult> FloorHits;
+    SweepFloor(GetProbeFrame(), FloorHits);
+    FloorNormalZ = ReduceFloorHits(FloorHits);
   }
 
-  return false;
+  // Same test as FVector::Parallel(-ImpactNormal, FVector::UpVector) on the hits
+  return FMath::Abs(FloorNormalZ) >= UE_THRESH_NORMALS_ARE_PARALLEL
+    && GetUnrotatedClimbVelocity().Z < -GetClimbProfile().FloorReachedSpeed;
 }
 
-bool UCustomMovementComponent::CheckHasReachedFloor()
+void UCustomMovementComponent::SweepFloor(const FClimbProbeFrame& InFrame, TArray<FHitResult>& OutFloorHits) const
 {
-  const FVector DownVector = -UpdatedComponent->GetUpVector();
-  const FVector StartOffset = DownVector * 50.f;
+  const FVector DownVector = -InFrame.GetUpVector();
+  const FVector StartOffset = DownVector * GetClimbProfile().FloorTraceOffset;
 
-  const FVector Start = UpdatedComponent->GetComponentLocation() + StartOffset;
+  const FVector Start = InFrame.Location + StartOffset;
   const FVector End = Start + DownVector;
 
-  TArray<FHitResult> PossibleFloorHits = DoCapsuleTraceMultiByObject(Start, End);
-
-  if (PossibleFloorHits.IsEmpty()) return false;
+  OutFloorHits = DoCapsuleTraceMulti(Start, End, EClimbTraceTarget::World);
+}
 
-  for (const FHitResult& PossibleFloorHit : PossibleFloorHits)
+float UCustomMovementComponent::ReduceFloorHits(const TArray<FHitResult>& InFloorHits)
+{
+  float FloorNormalZ = 0.f;
+  for (const FHitResult& FloorHit : InFloorHits)
   {
-    const bool bFloorReached =
-      FVector::Parallel(-PossibleFloorHit.ImpactNormal, FVector::UpVector) &&
-      GetUnrotatedClimbVelocity().Z < -10.f;
-
-    if (bFloorReached)
+    if (FMath::Abs(FloorHit.ImpactNormal.Z) > FMath::Abs(FloorNormalZ))
     {
-      return true;
+      FloorNormalZ = FloorHit.ImpactNormal.Z;
     }
   }
 
-  return false;
+  return FloorNormalZ;
 }
 
-FQuat UCustomMovementComponent::GetClimbRotation(float deltaTime)
+void UCustomMovementComponent::RunClimbProbes()
 {
-  const FQuat CurrentQuat = UpdatedComponent->GetComponentQuat();
+  LLM_SCOPE_BYTAG(Climbing);
 
-  if (HasAnimRootMotion() || CurrentRootMotion.HasOverrideVelocity())
-  {
-    return CurrentQuat;
-  }
+  ClimbProbeResults.bValid = false;
 
-  const FQuat TargetQuat = FRotationMatrix::MakeFromX(-CurrentClimbableSurfaceNormal).ToQuat();
+  if (!bHasClimbProbeSnapshot || !CVarClimbAsyncProbes.GetValueOnAnyThread()) return;
 
-  return FMath::QInterpTo(CurrentQuat, TargetQuat, deltaTime, 5.0f);;
-}
+  ClimbProbeResults.Frame = ClimbProbeSnapshot;
+  ClimbProbeResults.bFromAsyncPhysics = false;
 
-void UCustomMovementComponent::SnapMovementToClimbableSurfaces(float deltaTime)
-{
-  const FVector ComponentForward = UpdatedComponent->GetForwardVector();
-  const FVector ComponentLocation = UpdatedComponent->GetComponentLocation();
+  TArray<FHitResult> SurfaceHits;
+  SweepClimbableSurfaces(ClimbProbeResults.Frame, SurfaceHits, ClimbProbeResults.ContactsOrigin);
 
-  const FVector ProjectedCharacterToSurface = (CurrentClimbableSurfaceLocation - ComponentLocation).ProjectOnTo(ComponentForward);
-  const FVector SnapVector = -CurrentClimbableSurfaceNormal * ProjectedCharacterToSurface.Length();
+  // Off the game thread, so without the surface cache
+  ReduceClimbContacts(SurfaceHits, ClimbProbeResults.ContactsOrigin, nullptr, ClimbProbeResults.Contacts, ClimbProbeResults.ContactComponents);
 
-  UpdatedComponent->MoveComponent(SnapVector * deltaTime * MaxClimbSpeed, UpdatedComponent->GetComponentQuat(), true);
+  TArray<FHitResult> FloorHits;
+  SweepFloor(ClimbProbeResults.Frame, FloorHits);
+  ClimbProbeResults.FloorNormalZ = ReduceFloorHits(FloorHits);
+
+  ClimbProbeResults.bValid = true;
 }
 
-bool UCustomMovementComponent::CheckHasReachedLedge()
+bool UCustomMovementComponent::HasCurrentClimbProbeResults() const
 {
-  FHitResult LedgetHitResult = TraceFromEyeHeight(100.f, 50.f);
-
-  if (!LedgetHitResult.bBlockingHit)
-  {
-    const FVector WalkableSurfaceTraceStart = LedgetHitResult.TraceEnd;
-
-    const FVector DownVector = -UpdatedComponent->GetUpVector();
-    const FVector WalkableSurfaceTraceEnd = WalkableSurfaceTraceStart + DownVector * 100.f;
-
-    FHitResult WalkabkeSurfaceHitResult =
-      DoLineTraceSingleByObject(WalkableSurfaceTraceStart, WalkableSurfaceTraceEnd);
+  if (!ClimbProbeResults.bValid) return false;
 
-    if (WalkabkeSurfaceHitResult.bBlockingHit && GetUnrotatedClimbVelocity().Z > 10.f)
-    {
-      return true;
-    }
-  }
+  // Anything moving the character between the snapshot and this movement tick invalidates the results, e.g. teleports or moving bases
+  const FClimbProbeFrame CurrentFrame = GetProbeFrame();
+  const float LocationTolerance = ClimbProbeResults.bFromAsyncPhysics ? CVarClimbAsyncPhysicsMaxDrift.GetValueOnGameThread() : 0.01f;
+  const float RotationTolerance = ClimbProbeResults.bFromAsyncPhysics ? 1.e-2f : 1.e-4f;
 
-  return false;
+  return ClimbProbeResults.Frame.Location.Equals(CurrentFrame.Location, LocationTolerance)
+    && ClimbProbeResults.Frame.Rotation.Equals(CurrentFrame.Rotation, RotationTolerance)
+    && ClimbProbeResults.Frame.CapsuleHalfHeight == CurrentFrame.CapsuleHalfHeight;
 }
 
-bool UCustomMovementComponent::IsClimbing() const
+bool UCustomMovementComponent::AddToClimbBatch(FClimbSolverBatch& Batch)
 {
-  return MovementMode == MOVE_Custom && CustomMovementMode == ECustomMovementMode::MOVE_Climb;
-}
+  BatchedClimbSolve.bValid = false;
 
-// Trace for climbable surfaces, return true if there are valid surfaces
-bool UCustomMovementComponent::TraceClimbableSurfaces()
-{
-  const FVector StartOffset = UpdatedComponent->GetForwardVector() * 30.0f;
-  const FVector Start = UpdatedComponent->GetComponentLocation() + StartOffset;
-  const FVector End = Start + UpdatedComponent->GetForwardVector();
-  ClimbableSurfacesTracedResults = DoCapsuleTraceMultiByObject(Start, End);
+  if (!IsClimbing() || !HasCurrentClimbProbeResults()) return false;
 
-  return !ClimbableSurfacesTracedResults.IsEmpty();
+  ClimbContacts = ClimbProbeResults.Contacts;
+  ClimbContactComponents = ClimbProbeResults.ContactComponents;
+  ClimbContactsOrigin = ClimbProbeResults.ContactsOrigin;
+
+  Batch.AddClimber(ClimbContacts, ClimbContactsOrigin, MakeArrayView(&ClimbProbeResults.FloorNormalZ, 1), GetUnrotatedClimbVelocity().Z);
+  return true;
 }
 
-FHitResult UCustomMovementComponent::TraceFromEyeHeight(float TraceDistance, float TraceStartOffset, bool bShowDebugShape, bool bDrawPersistantShapes)
+void UCustomMovementComponent::ApplyClimbBatchResult(const FClimbSolverBatch& Batch, const FClimbSolverBatchResults& Results, int32 BatchIndex)
 {
-  const FVector ComponentLocation = UpdatedComponent->GetComponentLocation();
-  const FVector EyeHeightOffset = UpdatedComponent->GetUpVector() * (CharacterOwner->BaseEyeHeight + TraceStartOffset);
-  const FVector Start = ComponentLocation + EyeHeightOffset;
-  const FVector End = Start + UpdatedComponent->GetForwardVector() * TraceDistance;
-  return DoLineTraceSingleByObject(Start, End, bShowDebugShape, bDrawPersistantShapes);
+  BatchedClimbSolve.Location = Results.GetLocation(Batch, BatchIndex);
+  BatchedClimbSolve.Normal = Results.GetNormal(BatchIndex);
+  BatchedClimbSolve.TargetRotation = Results.GetRotation(BatchIndex);
+  BatchedClimbSolve.bShouldStop = Results.ShouldStopClimbing(BatchIndex);
+  BatchedClimbSolve.bFloorReached = Results.HasReachedFloor(BatchIndex);
+  BatchedClimbSolve.bValid = true;
 }
 
-void UCustomMovementComponent::PlayClimbMontage(UAnimMontage* MontageToPlay)
+bool UCustomMovementComponent::GetClimbSeparationAgent(FClimbSeparationAgent& OutAgent) const
 {
-  if (!MontageToPlay) return;
+  if (!IsClimbing() || ClimbContactComponents.IsEmpty() || bCornerWrapping || HasAnimRootMotion()) return false;
+
+  const UClimbProfile& Profile = GetClimbProfile();
+  if (Profile.ClimbSeparationRadius <= 0.f) return false;
+
+  // The component with the most contacts stands for the wall, so the key does not flip with the contact order.
+  // Instanced walls are told apart by instance.
+  int32 ContactsPerComponent[MaxClimbContacts] = {};
+  for (const FClimbContact& Contact : ClimbContacts)
+  {
+    ContactsPerComponent[Contact.ComponentIndex]++;
+  }
+
+  int32 WallComponentIndex = 0;
+  for (int32 ComponentIndex = 1; ComponentIndex < ClimbContactComponents.Num(); ComponentIndex++)
+  {
+    if (ContactsPerComponent[ComponentIndex] > ContactsPerComponent[WallComponentIndex])
+    {
+      WallComponentIndex = ComponentIndex;
+    }
+  }
+
+  const FClimbContactComponent& WallComponent = ClimbContactComponents[WallComponentIndex];
+  const UPrimitiveComponent* Wall = WallComponent.Component.Get();
+  if (!Wall) return false;
+
+  OutAgent.Location = UpdatedComponent->GetComponentLocation();
+  OutAgent.SurfaceNormal = CurrentClimbableSurfaceNormal;
+  OutAgent.WallKey = HashCombineFast(Wall->GetUniqueID(), static_cast<uint32>(WallComponent.InstanceIndex));
+  OutAgent.Radius = Profile.ClimbSeparationRadius;
+  OutAgent.MaxSpeed = Profile.MaxClimbSeparationSpeed;
+  return true;
+}
+
+void UCustomMovementComponent::RegisterClimbAsyncCallback()
+{
+  if (!CVarClimbAsyncPhysics.GetValueOnGameThread()) return;
+
+  FPhysScene* PhysScene = GetWorld()->GetPhysicsScene();
+  Chaos::FPhysicsSolver* Solver = PhysScene ? PhysScene->GetSolver() : nullptr;
+
+  // Without async physics the physics step runs inside the game frame, the probe tick already covers that case
+  if (!Solver || !Solver->IsUsingAsyncResults()) return;
+
+  ClimbAsyncCallback = Solver->CreateAndRegisterSimCallbackObject_External<FClimbAsyncCallback>();
+}
+
+void UCustomMovementComponent::UnregisterClimbAsyncCallback()
+{
+  if (!ClimbAsyncCallback) return;
+
+  FPhysScene* PhysScene = GetWorld()->GetPhysicsScene();
+  if (Chaos::FPhysicsSolver* Solver = PhysScene ? PhysScene->GetSolver() : nullptr)
+  {
+    Solver->UnregisterAndFreeSimCallbackObject_External(ClimbAsyncCallback);
+  }
+
+  ClimbAsyncCallback = nullptr;
+}
+
+void UCustomMovementComponent::ConsumeClimbAsyncOutputs()
+{
+  if (!ClimbAsyncCallback) return;
+
+  // Only the most recent physics step matters, older outputs are dropped with their handles
+  while (Chaos::TSimCallbackOutputHandle<FClimbAsyncOutput> AsyncOutput = ClimbAsyncCallback->PopOutputData_External())
+  {
+    if (!AsyncOutput->bValid) continue;
+
+    ClimbProbeResults.Frame = AsyncOutput->Frame;
+    ClimbProbeResults.ContactsOrigin = AsyncOutput->SurfaceTraceOrigin;
+    ReduceClimbContacts(AsyncOutput->SurfaceHits, AsyncOutput->SurfaceTraceOrigin, &ClimbSurfaceCache, ClimbProbeResults.Contacts, ClimbProbeResults.ContactComponents);
+    ClimbProbeResults.FloorNormalZ = ReduceFloorHits(AsyncOutput->FloorHits);
+    ClimbProbeResults.bValid = true;
+    ClimbProbeResults.bFromAsyncPhysics = true;
+  }
+}
+
+void UCustomMovementComponent::SendClimbAsyncInput(bool bClimbing)
+{
+  if (!ClimbAsyncCallback) return;
+
+  const UClimbProfile& Profile = GetClimbProfile();
+
+  FClimbAsyncInput* AsyncInput = ClimbAsyncCallback->GetProducerInputData_External();
+  AsyncInput->World = GetWorld();
+  AsyncInput->Frame = GetProbeFrame();
+  AsyncInput->bClimbing = bClimbing;
+  AsyncInput->CapsuleTraceRadius = Profile.ClimbCapsuleTraceRadius;
+  AsyncInput->CapsuleTraceHalfHeight = Profile.ClimbCapsuleTraceHalfHeight;
+  AsyncInput->SurfaceTraceOffset = Profile.SurfaceTraceOffset;
+  AsyncInput->FloorTraceOffset = Profile.FloorTraceOffset;
+  AsyncInput->TraceChannel = Profile.ClimbableTraceChannel;
+  AsyncInput->WorldObjectType = Profile.WorldTraceObjectType;
+}
+
+FQuat UCustomMovementComponent::GetClimbRotation(float deltaTime)
+{
+  const FQuat CurrentQuat = UpdatedComponent->GetComponentQuat();
+
+  if (HasAnimRootMotion() || CurrentRootMotion.HasOverrideVelocity())
+  {
+    return CurrentQuat;
+  }
+
+  // The corner wrap can replace the batched normal after the batch tick
+  if (BatchedClimbSolve.bValid && BatchedClimbSolve.Normal.Equals(CurrentClimbableSurfaceNormal))
+  {
+    return FMath::QInterpTo(CurrentQuat, BatchedClimbSolve.TargetRotation, deltaTime, GetClimbProfile().ClimbRotationInterpSpeed);
+  }
+
+  return ClimbSolver::InterpClimbRotation(CurrentQuat, CurrentClimbableSurfaceNormal, deltaTime, GetClimbProfile().ClimbRotationInterpSpeed);
+}
+
+void UCustomMovementComponent::SnapMovementToClimbableSurfaces(float deltaTime)
+{
+  const FVector ComponentForward = UpdatedComponent->GetForwardVector();
+  const FVector ComponentLocation = UpdatedComponent->GetComponentLocation();
+
+  const FVector SnapVector = ClimbSolver::GetSnapVector(
+    CurrentClimbableSurfaceLocation,
+    CurrentClimbableSurfaceNormal,
+    ComponentLocation,
+    ComponentForward
+  );
+
+  // Snaps as fast as the surface lets the climber move
+  const float SnapSpeed = GetClimbProfile().MaxClimbSpeed * CurrentClimbableSurfaceProperties.SpeedScale;
+  UpdatedComponent->MoveComponent(SnapVector * deltaTime * SnapSpeed, UpdatedComponent->GetComponentQuat(), true);
+}
+
+bool UCustomMovementComponent::CheckHasReachedLedge()
+{
+  // Only climbing up can reach a ledge, skip the traces otherwise
+  if (GetUnrotatedClimbVelocity().Z <= GetClimbProfile().LedgeReachedSpeed) return false;
+
+  return HasLedgeAbove(GetProbeFrame());
+}
+
+bool UCustomMovementComponent::HasLedgeAbove(const FClimbProbeFrame& InFrame) const
+{
+  const UClimbProfile& Profile = GetClimbProfile();
+
+  // Any wall above ends the ledge, climbable or not
+  const FVector LedgeTraceStart = InFrame.Location + InFrame.GetUpVector() * (InFrame.EyeHeight + Profile.LedgeAboveTraceOffset);
+  const FVector LedgeTraceEnd = LedgeTraceStart + InFrame.GetForwardVector() * Profile.EyeHeightTraceDistance;
+  FHitResult LedgetHitResult = DoLineTraceSingle(LedgeTraceStart, LedgeTraceEnd, EClimbTraceTarget::World);
+
+  if (!LedgetHitResult.bBlockingHit)
+  {
+    const FVector WalkableSurfaceTraceStart = LedgetHitResult.TraceEnd;
+
+    const FVector DownVector = -InFrame.GetUpVector();
+    const FVector WalkableSurfaceTraceEnd = WalkableSurfaceTraceStart + DownVector * Profile.LedgeAboveWalkableSurfaceTraceLength;
+
+    FHitResult WalkabkeSurfaceHitResult =
+      DoLineTraceSingle(WalkableSurfaceTraceStart, WalkableSurfaceTraceEnd, EClimbTraceTarget::World);
+
+    const FClimbInstanceData* InstanceClimbData = UClimbableInstancedMeshComponent::FindInstanceClimbData(WalkabkeSurfaceHitResult);
+    if (InstanceClimbData && !InstanceClimbData->bLedge) return false;
+
+    if (WalkabkeSurfaceHitResult.bBlockingHit)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool UCustomMovementComponent::IsClimbing() const
+{
+  return MovementMode == MOVE_Custom && CustomMovementMode == ECustomMovementMode::MOVE_Climb;
+}
+
+// Trace for climbable surfaces, return true if there are valid surfaces
+bool UCustomMovementComponent::TraceClimbableSurfaces()
+{
+  if (HasCurrentClimbProbeResults())
+  {
+    ClimbContacts = ClimbProbeResults.Contacts;
+    ClimbContactComponents = ClimbProbeResults.ContactComponents;
+    ClimbContactsOrigin = ClimbProbeResults.ContactsOrigin;
+    return !ClimbContacts.IsEmpty();
+  }
+
+  TArray<FHitResult> SurfaceHits;
+  FVector TraceOrigin;
+  SweepClimbableSurfaces(GetProbeFrame(), SurfaceHits, TraceOrigin);
+  StoreClimbContacts(SurfaceHits, TraceOrigin);
+
+  return !ClimbContacts.IsEmpty();
+}
+
+bool UCustomMovementComponent::SweepClimbableSurfaces(const FClimbProbeFrame& InFrame, TArray<FHitResult>& OutSurfaceHits, FVector& OutTraceOrigin) const
+{
+  const FVector StartOffset = InFrame.GetForwardVector() * GetClimbProfile().SurfaceTraceOffset;
+  const FVector Start = InFrame.Location + StartOffset;
+  const FVector End = Start + InFrame.GetForwardVector();
+
+  OutTraceOrigin = Start;
+  OutSurfaceHits = DoCapsuleTraceMulti(Start, End, EClimbTraceTarget::ClimbableSurfaces);
+
+  return !OutSurfaceHits.IsEmpty();
+}
+
+FClimbProbeFrame UCustomMovementComponent::GetProbeFrame() const
+{
+  FClimbProbeFrame ProbeFrame;
+  ProbeFrame.Location = UpdatedComponent->GetComponentLocation();
+  ProbeFrame.Rotation = UpdatedComponent->GetComponentQuat();
+  ProbeFrame.EyeHeight = CharacterOwner->BaseEyeHeight;
+  ProbeFrame.CapsuleHalfHeight = CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+
+  return ProbeFrame;
+}
+
+void UCustomMovementComponent::StoreClimbContacts(const TArray<FHitResult>& InSurfaceHits, const FVector& InOrigin)
+{
+  ClimbContactsOrigin = InOrigin;
+  ReduceClimbContacts(InSurfaceHits, InOrigin, &ClimbSurfaceCache, ClimbContacts, ClimbContactComponents);
+}
+
+void UCustomMovementComponent::ReduceClimbContacts(const TArray<FHitResult>& InSurfaceHits, const FVector& InOrigin,
+  TMap<TWeakObjectPtr<const UPhysicalMaterial>, FClimbSurfaceProperties>* InSurfaceCache,
+  TArray<FClimbContact, TFixedAllocator<MaxClimbContacts> >& OutContacts,
+  TArray<FClimbContactComponent, TFixedAllocator<MaxClimbContacts> >& OutContactComponents)
+{
+  OutContacts.Reset();
+  OutContactComponents.Reset();
+
+  for (const FHitResult& SurfaceHit : InSurfaceHits)
+  {
+    // Extra contacts barely move the averaged surface, drop them
+    if (OutContacts.Num() == MaxClimbContacts) break;
+
+    UPrimitiveComponent* HitComponent = SurfaceHit.GetComponent();
+
+    // Instances of a climbable instanced mesh carry their own metadata, each one gets its own slot
+    const FClimbInstanceData* InstanceClimbData = UClimbableInstancedMeshComponent::FindInstanceClimbData(SurfaceHit);
+    const int32 InstanceIndex = InstanceClimbData ? SurfaceHit.Item : INDEX_NONE;
+    const UPhysicalMaterial* PhysicalMaterial = InstanceClimbData ? nullptr : UClimbPhysicalMaterial::ResolvePhysicalMaterial(SurfaceHit);
+
+    int32 ComponentIndex = OutContactComponents.IndexOfByPredicate([HitComponent, InstanceIndex, PhysicalMaterial](const FClimbContactComponent& ContactComponent)
+      {
+        return ContactComponent.Component == HitComponent && ContactComponent.InstanceIndex == InstanceIndex
+          && ContactComponent.PhysicalMaterial == PhysicalMaterial;
+      });
+
+    if (ComponentIndex == INDEX_NONE)
+    {
+      const FClimbSurfaceProperties Surface = ResolveHitSurface(SurfaceHit, InSurfaceCache);
+
+      // Non climbable surfaces are rejected here, before they can affect the averaged surface
+      if (!Surface.bClimbable) continue;
+
+      ComponentIndex = OutContactComponents.Add({ HitComponent, InstanceIndex, PhysicalMaterial, Surface });
+    }
+
+    OutContacts.Emplace(SurfaceHit.ImpactPoint, SurfaceHit.ImpactNormal, InOrigin, (uint8)ComponentIndex);
+  }
+}
+
+FClimbSurfaceProperties UCustomMovementComponent::ResolveHitSurface(const FHitResult& InHit, TMap<TWeakObjectPtr<const UPhysicalMaterial>, FClimbSurfaceProperties>* InSurfaceCache)
+{
+  if (const FClimbInstanceData* InstanceClimbData = UClimbableInstancedMeshComponent::FindInstanceClimbData(InHit))
+  {
+    return InstanceClimbData->Surface;
+  }
+
+  const UPhysicalMaterial* PhysicalMaterial = UClimbPhysicalMaterial::ResolvePhysicalMaterial(InHit);
+  if (!InSurfaceCache) return UClimbPhysicalMaterial::GetSurfaceProperties(PhysicalMaterial);
+
+  if (const FClimbSurfaceProperties* CachedSurface = InSurfaceCache->Find(PhysicalMaterial))
+  {
+    return *CachedSurface;
+  }
+
+  // Start climbing probes also land here while walking, keep the cache from growing across the whole level
+  static constexpr int32 MaxCachedClimbSurfaces = 64;
+  if (InSurfaceCache->Num() >= MaxCachedClimbSurfaces)
+  {
+    InSurfaceCache->Reset();
+  }
+
+  return InSurfaceCache->Add(PhysicalMaterial, UClimbPhysicalMaterial::GetSurfaceProperties(PhysicalMaterial));
+}
+
+FHitResult UCustomMovementComponent::TraceFromEyeHeight(const FClimbProbeFrame& InFrame, float TraceDistance, float TraceStartOffset, bool bShowDebugShape, bool bDrawPersistantShapes) const
+{
+  const FVector ComponentLocation = InFrame.Location;
+  const FVector EyeHeightOffset = InFrame.GetUpVector() * (InFrame.EyeHeight + TraceStartOffset);
+  const FVector Start = ComponentLocation + EyeHeightOffset;
+  const FVector End = Start + InFrame.GetForwardVector() * TraceDistance;
+  return DoLineTraceSingle(Start, End, EClimbTraceTarget::ClimbableSurfaces, bShowDebugShape, bDrawPersistantShapes);
+}
+
+void UCustomMovementComponent::PlayClimbMontage(EClimbTransition InTransition)
+{
+  const TSoftObjectPtr<UAnimMontage>& MontageToPlay = GetTransitionMontage(InTransition);
+  if (MontageToPlay.IsNull()) return;
   if (!OwningPlayerAnimInstance) return;
   if (OwningPlayerAnimInstance->IsAnyMontagePlaying()) return;
 
-  OwningPlayerAnimInstance->Montage_Play(MontageToPlay);
+  // Only hitches if the preload did not get the chance to run, e.g. right after spawning next to a wall
+  UAnimMontage* LoadedMontage = MontageToPlay.Get();
+  if (!LoadedMontage)
+  {
+    LoadedMontage = MontageToPlay.LoadSynchronous();
+  }
+
+  CLIMB_VLOG(this, TEXT("Play climb montage %s"), *GetNameSafe(LoadedMontage));
+  OwningPlayerAnimInstance->Montage_Play(LoadedMontage);
+
+  if (GetOwnerRole() == ROLE_Authority)
+  {
+    ClimbTransitionSequence++;
+    ClimbReplicatedState.TransitionId = static_cast<uint8>((ClimbTransitionSequence << 4) | static_cast<uint8>(InTransition));
+  }
+}
+
+const TSoftObjectPtr<UAnimMontage>& UCustomMovementComponent::GetTransitionMontage(EClimbTransition InTransition) const
+{
+  const UClimbProfile& Profile = GetClimbProfile();
+
+  static const TSoftObjectPtr<UAnimMontage> NoMontage;
+
+  switch (InTransition)
+  {
+  case EClimbTransition::IdleToClimb: return Profile.IdleToClimbMontage;
+  case EClimbTransition::ClimbToTop: return Profile.ClimbToTopMontage;
+  case EClimbTransition::ClimbDownLedge: return Profile.ClimbDownLedgeMontage;
+  case EClimbTransition::Vault: return Profile.VaultMontage;
+  case EClimbTransition::HopUp: return Profile.HopUpMontage;
+  case EClimbTransition::HopDown: return Profile.HopDownMontage;
+  case EClimbTransition::InnerCornerWrap: return Profile.InnerCornerWrapMontage;
+  case EClimbTransition::OuterCornerWrap: return Profile.OuterCornerWrapMontage;
+  default: return NoMontage;
+  }
+}
+
+void UCustomMovementComponent::UpdateClimbMontagesPreload(float DeltaTime)
+{
+  const UClimbProfile& Profile = GetClimbProfile();
+
+  TimeSinceClimbMontagesPreloadCheck += DeltaTime;
+  if (TimeSinceClimbMontagesPreloadCheck < Profile.ClimbMontagesPreloadCheckInterval) return;
+
+  // Outside every climbable region counts as away without probing
+  bool bNearClimbableGeometry = IsClimbing();
+  if (!bNearClimbableGeometry && IsClimbCandidate())
+  {
+    // Only climbable geometry blocks the climbable channel, so this stays cheap in open areas
+    const bool bProbed = UClimbProbeBudgetSubsystem::RunProbe(this, MontagesPreloadProbeCost, [this, &Profile, &bNearClimbableGeometry]()
+    {
+      bNearClimbableGeometry = GetWorld()->OverlapAnyTestByChannel(
+        UpdatedComponent->GetComponentLocation(),
+        FQuat::Identity,
+        Profile.ClimbableTraceChannel,
+        FCollisionShape::MakeSphere(Profile.ClimbMontagesPreloadRadius),
+        FCollisionQueryParams(SCENE_QUERY_STAT(ClimbMontagesPreload), false)
+      );
+    });
+
+    // Checked again next frame, a deferred probe says nothing about the surroundings
+    if (!bProbed) return;
+  }
+
+  const float ElapsedTime = TimeSinceClimbMontagesPreloadCheck;
+  TimeSinceClimbMontagesPreloadCheck = 0.f;
+
+  if (bNearClimbableGeometry)
+  {
+    TimeAwayFromClimbableGeometry = 0.f;
+
+    if (!ClimbMontagesHandle.IsValid())
+    {
+      TArray<FSoftObjectPath> ClimbMontagePaths;
+      for (uint8 Transition = 1; Transition < static_cast<uint8>(EClimbTransition::Num); Transition++)
+      {
+        const TSoftObjectPtr<UAnimMontage>& ClimbMontage = GetTransitionMontage(static_cast<EClimbTransition>(Transition));
+        if (!ClimbMontage.IsNull())
+        {
+          ClimbMontagePaths.Add(ClimbMontage.ToSoftObjectPath());
+        }
+      }
+
+      ClimbMontagesHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(ClimbMontagePaths);
+    }
+  }
+  else if (ClimbMontagesHandle.IsValid())
+  {
+    TimeAwayFromClimbableGeometry += ElapsedTime;
+
+    if (TimeAwayFromClimbableGeometry >= Profile.ClimbMontagesReleaseDelay)
+    {
+      ClimbMontagesHandle->ReleaseHandle();
+      ClimbMontagesHandle.Reset();
+    }
+  }
 }
 
 void UCustomMovementComponent::OnClimbMontageEnded(UAnimMontage* Montage, bool bInterrupted)
 {
-  if (Montage == IdleToClimbMontage || Montage == ClimbDownLedgeMontage)
+  if (!Montage) return;
+
+  const UClimbProfile& Profile = GetClimbProfile();
+
+  if (Montage == Profile.InnerCornerWrapMontage.Get() || Montage == Profile.OuterCornerWrapMontage.Get())
+  {
+    bCornerWrapping = false;
+  }
+
+  // Proxies only play transitions for show, their movement mode comes from the server
+  if (GetOwnerRole() == ROLE_SimulatedProxy) return;
+
+  if (Montage == Profile.IdleToClimbMontage.Get() || Montage == Profile.ClimbDownLedgeMontage.Get())
   {
     StartClimbing();
     StopMovementImmediately();
   }
 
-  if (Montage == ClimbToTopMontage || Montage == VaultMontage)
+  if (Montage == Profile.ClimbToTopMontage.Get() || Montage == Profile.VaultMontage.Get())
   {
     SetMovementMode(MOVE_Walking);
   }
@@ -511,55 +1435,152 @@ void UCustomMovementComponent::RequestHopping()
   const FVector UnrotatedLastInputVector =
     UKismetMathLibrary::Quat_UnrotateVector(UpdatedComponent->GetComponentQuat(), GetLastInputVector());
 
-  const float DotResult =
-    FVector::DotProduct(UnrotatedLastInputVector.GetSafeNormal(), FVector::UpVector);
+  const EClimbHopDirection HopDirection = ClimbSolver::ClassifyHopDirection(UnrotatedLastInputVector);
+
+  // Only happens when hopping on the very first climb frame, candidates are kept fresh by PhysClimb afterwards
+  if (bHopCandidatesDirty)
+  {
+    UpdateHopCandidates();
+  }
 
-  if (DotResult >= 0.9f)
+  if (HopDirection == EClimbHopDirection::Up)
   {
     HandleHopUp();
   }
-  else if (DotResult <= -0.9f)
+  else if (HopDirection == EClimbHopDirection::Down)
   {
     HandleHopDown();
   }
 }
 
+void UCustomMovementComponent::EnterClimbableRegion(const AClimbableRegionVolume* InRegion)
+{
+  OverlappedClimbableRegions.AddUnique(InRegion);
+  CLIMB_VLOG(this, TEXT("Entered climbable region %s"), *GetNameSafe(InRegion));
+}
+
+void UCustomMovementComponent::ExitClimbableRegion(const AClimbableRegionVolume* InRegion)
+{
+  OverlappedClimbableRegions.RemoveSwap(InRegion);
+  CLIMB_VLOG(this, TEXT("Left climbable region %s"), *GetNameSafe(InRegion));
+}
+
+bool UCustomMovementComponent::IsClimbCandidate() const
+{
+  if (!CVarClimbRegionGating.GetValueOnGameThread()) return true;
+
+  const UClimbRegionSubsystem* ClimbRegionSubsystem = GetWorld()->GetSubsystem<UClimbRegionSubsystem>();
+  if (!ClimbRegionSubsystem || !ClimbRegionSubsystem->HasRegions()) return true;
+
+  // Regions destroyed while overlapped leave stale entries behind
+  for (const TWeakObjectPtr<const AClimbableRegionVolume>& Region : OverlappedClimbableRegions)
+  {
+    if (Region.IsValid()) return true;
+  }
+  return false;
+}
+
+void UCustomMovementComponent::StampClimbInput()
+{
+  // Keeps the oldest input, latency is measured from when the player first acted
+  if (!PendingClimbInputStamp.IsSet())
+  {
+    PendingClimbInputStamp = FClimbInputStamp::Now();
+  }
+}
+
 void UCustomMovementComponent::SetMotionWarpTarget(const FName& InWarpTargetName, const FVector& InTargetPosition)
 {
   if (!OwningPlayerCharacter) return;
 
+  CLIMB_VLOG_LOCATION(this, InTargetPosition, 10.f, FColor::Yellow, TEXT("Warp target %s"), *InWarpTargetName.ToString());
+
   OwningPlayerCharacter->GetMotionWarpingComponent()->AddOrUpdateWarpTargetFromLocation(
     InWarpTargetName,
     InTargetPosition
   );
 }
 
-void UCustomMovementComponent::HandleHopUp()
+void UCustomMovementComponent::SetMotionWarpTarget(const FName& InWarpTargetName, const FVector& InTargetPosition, const FQuat& InTargetRotation)
+{
+  if (!OwningPlayerCharacter) return;
+
+  CLIMB_VLOG_ARROW(this, InTargetPosition, InTargetPosition + InTargetRotation.GetForwardVector() * 30.f, FColor::Yellow,
+    TEXT("Warp target %s"), *InWarpTargetName.ToString());
+
+  OwningPlayerCharacter->GetMotionWarpingComponent()->AddOrUpdateWarpTargetFromLocationAndRotation(
+    InWarpTargetName,
+    InTargetPosition,
+    InTargetRotation.Rotator()
+  );
+}
+
+void UCustomMovementComponent::TryStartCornerWrap()
 {
-  FVector HopUpTargetPoint;
+  if (bCornerWrapping || HasAnimRootMotion()) return;
+  if (OwningPlayerAnimInstance && OwningPlayerAnimInstance->IsAnyMontagePlaying()) return;
+
+  const UClimbProfile& Profile = GetClimbProfile();
+  const FClimbCorner Corner = ClimbSolver::DetectCorner(
+    ClimbContacts,
+    ClimbContactsOrigin,
+    -UpdatedComponent->GetForwardVector(),
+    Velocity.GetSafeNormal(),
+    Profile.MinCornerAngle,
+    Profile.StopClimbingAngle
+  );
+
+  if (Corner.Type == EClimbCornerType::None) return;
 
-  if (CheckCanHopUp(HopUpTargetPoint))
+  CLIMB_VLOG_ARROW(this, Corner.Location, Corner.Location + Corner.Normal * 60.f, FColor::Magenta,
+    TEXT("%s corner"), Corner.Type == EClimbCornerType::Inner ? TEXT("Inner") : TEXT("Outer"));
+
+  const EClimbTransition WrapTransition =
+    Corner.Type == EClimbCornerType::Inner ? EClimbTransition::InnerCornerWrap : EClimbTransition::OuterCornerWrap;
+
+  if (GetTransitionMontage(WrapTransition).IsNull() || !OwningPlayerCharacter || !OwningPlayerAnimInstance)
   {
+    // No wrap montage, climb on the next face right away so rotation follows it instead of the averaged normal
+    CurrentClimbableSurfaceLocation = Corner.Location;
+    CurrentClimbableSurfaceNormal = Corner.Normal;
+    return;
+  }
+
+  // Keep the same distance off the next face as off the current one
+  const float SurfaceDistance = FVector::DotProduct(
+    UpdatedComponent->GetComponentLocation() - CurrentClimbableSurfaceLocation, CurrentClimbableSurfaceNormal);
+
+  SetMotionWarpTarget(FName("CornerWrapPoint"), Corner.Location + Corner.Normal * SurfaceDistance, ClimbSolver::GetTargetRotation(Corner.Normal));
+  PlayClimbMontage(WrapTransition);
+  bCornerWrapping = OwningPlayerAnimInstance->IsAnyMontagePlaying();
+}
+
+void UCustomMovementComponent::HandleHopUp()
+{
+  if (HopUpCandidate.bValid)
+  {
+    const FVector HopUpTargetPoint = UpdatedComponent->GetComponentTransform().TransformPosition(HopUpCandidate.LocalTargetPosition);
     SetMotionWarpTarget(FName("HopUpTargetPoint"), HopUpTargetPoint);
-    PlayClimbMontage(HopUpMontage);
+    PlayClimbMontage(EClimbTransition::HopUp);
   }
 }
 
 void UCustomMovementComponent::HandleHopDown()
 {
-  FVector HopDownTargetPoint;
-
-  if (CheckCanHopDown(HopDownTargetPoint))
+  if (HopDownCandidate.bValid)
   {
+    const FVector HopDownTargetPoint = UpdatedComponent->GetComponentTransform().TransformPosition(HopDownCandidate.LocalTargetPosition);
     SetMotionWarpTarget(FName("HopDownTargetPoint"), HopDownTargetPoint);
-    PlayClimbMontage(HopDownMontage);
+    PlayClimbMontage(EClimbTransition::HopDown);
   }
 }
 
-bool UCustomMovementComponent::CheckCanHopUp(FVector& OutHopUpTargetPosition)
+bool UCustomMovementComponent::CheckCanHopUp(const FClimbProbeFrame& InFrame, FVector& OutHopUpTargetPosition) const
 {
-  FHitResult HopUpHit = TraceFromEyeHeight(100.f, -20.0f);
-  FHitResult SaftyLedgeHit = TraceFromEyeHeight(100.f, 150.0f);
+  const UClimbProfile& Profile = GetClimbProfile();
+
+  FHitResult HopUpHit = TraceFromEyeHeight(InFrame, Profile.EyeHeightTraceDistance, Profile.HopUpTraceOffset);
+  FHitResult SaftyLedgeHit = TraceFromEyeHeight(InFrame, Profile.EyeHeightTraceDistance, Profile.HopUpSafetyLedgeTraceOffset);
 
   if (HopUpHit.bBlockingHit && SaftyLedgeHit.bBlockingHit)
   {
@@ -571,9 +1592,9 @@ bool UCustomMovementComponent::CheckCanHopUp(FVector& OutHopUpTargetPosition)
   return false;
 }
 
-bool UCustomMovementComponent::CheckCanHopDown(FVector& OutHopDownTargetPosition)
+bool UCustomMovementComponent::CheckCanHopDown(const FClimbProbeFrame& InFrame, FVector& OutHopDownTargetPosition) const
 {
-  FHitResult HopDownHit = TraceFromEyeHeight(100.f, -300.0f);
+  FHitResult HopDownHit = TraceFromEyeHeight(InFrame, GetClimbProfile().EyeHeightTraceDistance, GetClimbProfile().HopDownTraceOffset);
 
   if (HopDownHit.bBlockingHit)
   {
@@ -585,9 +1606,315 @@ bool UCustomMovementComponent::CheckCanHopDown(FVector& OutHopDownTargetPosition
   return false;
 }
 
+void UCustomMovementComponent::RefreshHopCandidates(float deltaTime)
+{
+  const UClimbProfile& Profile = GetClimbProfile();
+
+  TimeSinceHopCandidatesRefresh += deltaTime;
+
+  const bool bRefreshIntervalElapsed =
+    Profile.HopCandidateRefreshInterval > 0.f && TimeSinceHopCandidatesRefresh >= Profile.HopCandidateRefreshInterval;
+
+  const bool bMovedPastThreshold =
+    FVector::DistSquared(UpdatedComponent->GetComponentLocation(), HopCandidatesRefreshLocation) >= FMath::Square(Profile.HopCandidateRefreshDistance);
+
+  if (bHopCandidatesDirty || bRefreshIntervalElapsed || bMovedPastThreshold)
+  {
+    // Deferred refreshes keep the previous candidates, the conditions above still hold next frame
+    UClimbProbeBudgetSubsystem::RunProbe(this, HopCandidatesProbeCost, [this]() { UpdateHopCandidates(); });
+  }
+}
+
+void UCustomMovementComponent::UpdateHopCandidates()
+{
+  const FTransform& ComponentTransform = UpdatedComponent->GetComponentTransform();
+  const FClimbProbeFrame ProbeFrame = GetProbeFrame();
+
+  FVector HopUpTargetPoint = FVector::ZeroVector;
+  HopUpCandidate.bValid = CheckCanHopUp(ProbeFrame, HopUpTargetPoint);
+  HopUpCandidate.LocalTargetPosition = ComponentTransform.InverseTransformPosition(HopUpTargetPoint);
+
+  FVector HopDownTargetPoint = FVector::ZeroVector;
+  HopDownCandidate.bValid = CheckCanHopDown(ProbeFrame, HopDownTargetPoint);
+  HopDownCandidate.LocalTargetPosition = ComponentTransform.InverseTransformPosition(HopDownTargetPoint);
+
+  bHopCandidatesDirty = false;
+  TimeSinceHopCandidatesRefresh = 0.f;
+  HopCandidatesRefreshLocation = ComponentTransform.GetLocation();
+}
+
+const UClimbProfile& UCustomMovementComponent::GetClimbProfile() const
+{
+  return ClimbProfile ? *ClimbProfile : *GetDefault<UClimbProfile>();
+}
+
+ECollisionChannel UCustomMovementComponent::GetClimbableTraceChannel() const
+{
+  return GetClimbProfile().ClimbableTraceChannel;
+}
+
+#if WITH_EDITOR
+void UCustomMovementComponent::OnClimbProfileChanged(const UClimbProfile* InProfile)
+{
+  const UClimbProfile& Profile = GetClimbProfile();
+  if (InProfile != &Profile) return;
+
+  // Everything else is read from the profile when used, only state derived from it needs a refresh
+  if (IsClimbing())
+  {
+    CharacterOwner->GetCapsuleComponent()->SetCapsuleHalfHeight(Profile.ClimbCapsuleHalfHeight);
+    SendClimbAsyncInput(true);
+  }
+
+  if (ClimbMontagesHandle.IsValid())
+  {
+    ClimbMontagesHandle->ReleaseHandle();
+    ClimbMontagesHandle.Reset();
+    TimeSinceClimbMontagesPreloadCheck = Profile.ClimbMontagesPreloadCheckInterval;
+  }
+
+  bHopCandidatesDirty = true;
+  CLIMB_VLOG(this, TEXT("Climb profile %s reloaded"), *GetNameSafe(InProfile));
+}
+#endif
+
+bool UCustomMovementComponent::HasPendingClimbTransition() const
+{
+  return bCornerWrapping || (OwningPlayerAnimInstance && OwningPlayerAnimInstance->IsAnyMontagePlaying());
+}
+
+void UCustomMovementComponent::PublishClimbAnimSnapshot(bool bAfterMove)
+{
+  FClimbAnimSnapshot NewSnapshot;
+  NewSnapshot.Velocity = Velocity;
+  NewSnapshot.Acceleration = GetCurrentAcceleration();
+  NewSnapshot.ClimbVelocity = GetUnrotatedClimbVelocity();
+  NewSnapshot.bIsClimbing = IsClimbing();
+  NewSnapshot.bIsFalling = IsFalling();
+  NewSnapshot.Frame = GFrameCounter;
+
+  // Input issued before this tick has now moved the character
+  if (bAfterMove && PendingClimbInputStamp.IsSet())
+  {
+    ClimbLatency::RecordInputToMovement(PendingClimbInputStamp);
+    NewSnapshot.InputStamp = PendingClimbInputStamp;
+    PendingClimbInputStamp = FClimbInputStamp();
+  }
+
+  FWriteScopeLock WriteLock(ClimbAnimSnapshotLock);
+  ClimbAnimSnapshot = NewSnapshot;
+}
+
+FClimbAnimSnapshot UCustomMovementComponent::GetClimbAnimSnapshot() const
+{
+  FReadScopeLock ReadLock(ClimbAnimSnapshotLock);
+  return ClimbAnimSnapshot;
+}
+
+void UCustomMovementComponent::ResetClimbState()
+{
+  if (OwningPlayerAnimInstance)
+  {
+    OwningPlayerAnimInstance->StopAllMontages(0.f);
+  }
+
+  // Leaving the climb state runs the usual cleanup in OnMovementModeChanged
+  if (IsClimbing())
+  {
+    StopClimbing();
+  }
+
+  ClimbContacts.Reset();
+  ClimbContactComponents.Reset();
+  ClimbSurfaceCache.Empty();
+  CurrentClimbableSurfaceProperties = FClimbSurfaceProperties();
+  CurrentClimbableSurfaceLocation = FVector::ZeroVector;
+  CurrentClimbableSurfaceNormal = FVector::ZeroVector;
+
+  HopUpCandidate = FClimbHopCandidate();
+  HopDownCandidate = FClimbHopCandidate();
+  bHopCandidatesDirty = true;
+  TimeSinceHopCandidatesRefresh = 0.f;
+
+  bCornerWrapping = false;
+  bHasClimbProbeSnapshot = false;
+  ClimbProbeResults.bValid = false;
+  BatchedClimbSolve.bValid = false;
+  ClimbSeparationVelocity = FVector::ZeroVector;
+  ClimbFixedStepper.Reset();
+
+  PendingClimbInputStamp = FClimbInputStamp();
+  {
+    FWriteScopeLock WriteLock(ClimbAnimSnapshotLock);
+    ClimbAnimSnapshot = FClimbAnimSnapshot();
+  }
+
+  ClimbReplicatedState = FClimbReplicatedState();
+  ClimbTransitionSequence = 0;
+
+  // Not climbing anymore, so this wakes a dormant or throttled climber
+  if (bClimbNetIdle)
+  {
+    UpdateClimbNetIdle(0.f);
+  }
+  ClimbNetIdleTime = 0.f;
+
+  StopMovementImmediately();
+}
+
+void UCustomMovementComponent::GetClimbedComponents(TArray<const UPrimitiveComponent*>& OutComponents) const
+{
+  OutComponents.Reset();
+
+  for (const FClimbContactComponent& ContactComponent : ClimbContactComponents)
+  {
+    if (const UPrimitiveComponent* Component = ContactComponent.Component.Get())
+    {
+      OutComponents.AddUnique(Component);
+    }
+  }
+}
+
 FVector UCustomMovementComponent::GetUnrotatedClimbVelocity() const
 {
+  if (GetOwnerRole() == ROLE_SimulatedProxy && ClimbReplicatedState.bClimbing)
+  {
+    return ClimbReplicatedState.GetLocalVelocity();
+  }
+
   return UKismetMathLibrary::Quat_UnrotateVector(UpdatedComponent->GetComponentQuat(), Velocity);
 }
 
+void UCustomMovementComponent::UpdateClimbReplicatedState()
+{
+  ClimbReplicatedState.bClimbing = IsClimbing();
+
+  if (ClimbReplicatedState.bClimbing)
+  {
+    ClimbReplicatedState.Location = UpdatedComponent->GetComponentLocation();
+    ClimbReplicatedState.SetSurfaceNormal(CurrentClimbableSurfaceNormal);
+    ClimbReplicatedState.SetLocalVelocity(GetUnrotatedClimbVelocity());
+  }
+  else
+  {
+    ClimbReplicatedState.Location = FVector::ZeroVector;
+    ClimbReplicatedState.SetSurfaceNormal(FVector::ZeroVector);
+    ClimbReplicatedState.SetLocalVelocity(FVector::ZeroVector);
+  }
+}
+
+void UCustomMovementComponent::UpdateClimbMovementReplication()
+{
+  // Root motion transitions replicate through the character, they keep ReplicatedMovement
+  const bool bShouldCutMovementReplication = IsClimbing() && !HasAnimRootMotion();
+  if (bShouldCutMovementReplication == bClimbMovementReplicationCut) return;
+
+  // Owners that never replicated movement are left alone
+  if (bShouldCutMovementReplication && !CharacterOwner->IsReplicatingMovement()) return;
+
+  bClimbMovementReplicationCut = bShouldCutMovementReplication;
+  CharacterOwner->SetReplicateMovement(!bClimbMovementReplicationCut);
+
+  CLIMB_VLOG(this, TEXT("Climb movement replication %s"), bClimbMovementReplicationCut ? TEXT("from the climb state") : TEXT("from ReplicatedMovement"));
+}
+
+void UCustomMovementComponent::UpdateClimbNetIdle(float DeltaTime)
+{
+  const UClimbProfile& Profile = GetClimbProfile();
+
+  AActor* Owner = GetOwner();
+
+  const bool bHangingStill = IsClimbing() && Velocity.IsNearlyZero(1.f) && !HasAnimRootMotion();
+  ClimbNetIdleTime = bHangingStill ? ClimbNetIdleTime + DeltaTime : 0.f;
+
+  const bool bShouldBeNetIdle = ClimbNetIdleTime >= Profile.ClimbNetIdleThreshold;
+  if (bShouldBeNetIdle == bClimbNetIdle) return;
+
+  bClimbNetIdle = bShouldBeNetIdle;
+
+  if (bClimbNetIdle)
+  {
+    if (Profile.bAllowClimbNetDormancy && !CharacterOwner->IsPlayerControlled())
+    {
+      Owner->SetNetDormancy(DORM_DormantAll);
+      bClimbNetDormant = true;
+    }
+    else
+    {
+      ClimbActiveNetUpdateFrequency = Owner->NetUpdateFrequency;
+      Owner->NetUpdateFrequency = FMath::Min(Owner->NetUpdateFrequency, Profile.ClimbNetIdleUpdateFrequency);
+    }
+
+    CLIMB_VLOG(this, TEXT("Climb net idle, %s"), bClimbNetDormant ? TEXT("dormant") : TEXT("low update frequency"));
+    return;
+  }
+
+  if (bClimbNetDormant)
+  {
+    Owner->SetNetDormancy(DORM_Awake);
+    bClimbNetDormant = false;
+  }
+  else
+  {
+    Owner->NetUpdateFrequency = ClimbActiveNetUpdateFrequency;
+  }
+
+  Owner->ForceNetUpdate();
+  CLIMB_VLOG(this, TEXT("Climb net active"));
+}
+
+void UCustomMovementComponent::OnRep_ClimbReplicatedState(const FClimbReplicatedState& PreviousState)
+{
+  if (ClimbReplicatedState.bClimbing)
+  {
+    CurrentClimbableSurfaceNormal = ClimbReplicatedState.GetSurfaceNormal();
+
+    // ReplicatedMovement is cut while climbing, unless a root motion transition brought it back
+    if (!CharacterOwner->IsReplicatingMovement())
+    {
+      ApplyClimbReplicatedMovement();
+    }
+  }
+
+  if (ClimbReplicatedState.TransitionId == PreviousState.TransitionId) return;
+  if (ClimbReplicatedState.GetTransition() == EClimbTransition::None) return;
+
+  // Montages drive proxies through replicated root motion, starting them here only adds the pose
+  PlayClimbMontage(ClimbReplicatedState.GetTransition());
+}
+
+void UCustomMovementComponent::ApplyClimbReplicatedMovement()
+{
+  if (!UpdatedComponent || CharacterOwner->GetLocalRole() != ROLE_SimulatedProxy) return;
+
+  // Same as ACharacter::PostNetReceiveLocationAndRotation, the mesh smooths over the correction and SimulateMovement extrapolates with Velocity
+  const FVector OldLocation = UpdatedComponent->GetComponentLocation();
+  const FQuat OldRotation = UpdatedComponent->GetComponentQuat();
+
+  const FVector NewLocation = ClimbReplicatedState.Location;
+  const FQuat NewRotation = ClimbSolver::GetTargetRotation(CurrentClimbableSurfaceNormal);
+
+  UpdatedComponent->SetWorldLocationAndRotation(NewLocation, NewRotation, false, nullptr, ETeleportType::TeleportPhysics);
+  Velocity = NewRotation.RotateVector(ClimbReplicatedState.GetLocalVelocity());
+
+  bNetworkSmoothingComplete = false;
+  bJustTeleported |= OldLocation != NewLocation;
+  SmoothCorrection(OldLocation, OldRotation, NewLocation, NewRotation);
+  CharacterOwner->OnUpdateSimulatedPosition(OldLocation, OldRotation);
+}
+
+SIZE_T UCustomMovementComponent::GetClimbMemoryFootprint() const
+{
+  // Only the climb members, the rest of the component is ordinary character movement state
+  const SIZE_T ClimbMembersSize = sizeof(ClimbContacts) + sizeof(ClimbContactComponents) + sizeof(ClimbContactsOrigin)
+    + sizeof(ClimbSurfaceCache) + sizeof(CurrentClimbableSurfaceProperties) + sizeof(CurrentClimbableSurfaceLocation)
+    + sizeof(CurrentClimbableSurfaceNormal) + sizeof(HopUpCandidate) + sizeof(HopDownCandidate)
+    + sizeof(ClimbProbeTickFunction) + sizeof(ClimbProbeResults) + sizeof(BatchedClimbSolve) + sizeof(ClimbSeparationVelocity)
+    + sizeof(ClimbFixedStepper) + sizeof(ClimbProbeSnapshot) + sizeof(ClimbAnimSnapshot) + sizeof(OverlappedClimbableRegions)
+    + sizeof(ClimbReplicatedState) + sizeof(ClimbMontagesHandle);
+
+  // Contacts, the probe results included, live in inline fixed arrays, so they are part of the members themselves
+  return ClimbMembersSize + ClimbSurfaceCache.GetAllocatedSize() + OverlappedClimbableRegions.GetAllocatedSize();
+}
+
 #pragma endregion
\ No newline at end of file
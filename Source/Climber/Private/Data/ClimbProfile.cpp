@@ -0,0 +1,15 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Data/ClimbProfile.h"
+
+#if WITH_EDITOR
+FOnClimbProfileChanged UClimbProfile::OnClimbProfileChanged;
+
+void UClimbProfile::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+  Super::PostEditChangeProperty(PropertyChangedEvent);
+
+  OnClimbProfileChanged.Broadcast(this);
+}
+#endif
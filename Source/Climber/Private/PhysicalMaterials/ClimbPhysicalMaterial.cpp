@@ -0,0 +1,25 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "PhysicalMaterials/ClimbPhysicalMaterial.h"
+#include "Components/PrimitiveComponent.h"
+
+const UPhysicalMaterial* UClimbPhysicalMaterial::ResolvePhysicalMaterial(const FHitResult& InHit)
+{
+  // Multi material meshes report the material of the hit shape here, when the query asked for it
+  if (const UPhysicalMaterial* HitPhysicalMaterial = InHit.PhysMaterial.Get())
+  {
+    return HitPhysicalMaterial;
+  }
+
+  const UPrimitiveComponent* HitComponent = InHit.GetComponent();
+  const FBodyInstance* BodyInstance = HitComponent ? HitComponent->GetBodyInstance() : nullptr;
+
+  return BodyInstance ? BodyInstance->GetSimplePhysicalMaterial() : nullptr;
+}
+
+FClimbSurfaceProperties UClimbPhysicalMaterial::GetSurfaceProperties(const UPhysicalMaterial* InPhysicalMaterial)
+{
+  const UClimbPhysicalMaterial* ClimbMaterial = Cast<UClimbPhysicalMaterial>(InPhysicalMaterial);
+  return ClimbMaterial ? ClimbMaterial->ClimbSurface : FClimbSurfaceProperties();
+}
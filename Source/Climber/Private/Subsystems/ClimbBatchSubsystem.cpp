@@ -0,0 +1,164 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Subsystems/ClimbBatchSubsystem.h"
+#include "Components/CustomMovementComponent.h"
+#include "Data/ClimbProfile.h"
+#include "Engine/World.h"
+
+static TAutoConsoleVariable<bool> CVarClimbBatchSolve(
+  TEXT("Climber.BatchSolve"),
+  true,
+  TEXT("Solves the climb surfaces of all climbers with probe tick results in one batched pass.")
+);
+
+static TAutoConsoleVariable<bool> CVarClimbSeparation(
+  TEXT("Climber.Separation"),
+  true,
+  TEXT("Pushes climbers on the same wall apart in the surface plane before they move.")
+);
+
+void FClimbBatchTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+  if (Target)
+  {
+    Target->SolveClimbers();
+  }
+}
+
+FString FClimbBatchTickFunction::DiagnosticMessage()
+{
+  return TEXT("FClimbBatchTickFunction");
+}
+
+bool UClimbBatchSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+  return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UClimbBatchSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+  Super::OnWorldBeginPlay(InWorld);
+
+  BatchTickFunction.bCanEverTick = true;
+  BatchTickFunction.bStartWithTickEnabled = true;
+  BatchTickFunction.TickGroup = TG_PrePhysics;
+  BatchTickFunction.Target = this;
+  BatchTickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void UClimbBatchSubsystem::Deinitialize()
+{
+  if (BatchTickFunction.IsTickFunctionRegistered())
+  {
+    BatchTickFunction.UnRegisterTickFunction();
+  }
+
+  Climbers.Reset();
+
+  Super::Deinitialize();
+}
+
+void UClimbBatchSubsystem::RegisterClimber(UCustomMovementComponent* InClimber)
+{
+  if (!InClimber) return;
+
+  Climbers.AddUnique(InClimber);
+
+  // Probe results in, solved surface out, before the climber moves
+  BatchTickFunction.AddPrerequisite(InClimber, InClimber->ClimbProbeTickFunction);
+  InClimber->PrimaryComponentTick.AddPrerequisite(this, BatchTickFunction);
+}
+
+void UClimbBatchSubsystem::UnregisterClimber(UCustomMovementComponent* InClimber)
+{
+  if (!InClimber) return;
+
+  Climbers.RemoveSingleSwap(InClimber);
+
+  BatchTickFunction.RemovePrerequisite(InClimber, InClimber->ClimbProbeTickFunction);
+  InClimber->PrimaryComponentTick.RemovePrerequisite(this, BatchTickFunction);
+}
+
+void UClimbBatchSubsystem::SolveClimbers()
+{
+  if (CVarClimbBatchSolve.GetValueOnGameThread())
+  {
+    SolveBatches();
+  }
+
+  if (CVarClimbSeparation.GetValueOnGameThread())
+  {
+    SeparateClimbers();
+  }
+}
+
+void UClimbBatchSubsystem::SolveBatches()
+{
+  for (FProfileBatch& ProfileBatch : ProfileBatches)
+  {
+    ProfileBatch.Batch.Reset();
+    ProfileBatch.Climbers.Reset();
+    ProfileBatch.bInUse = false;
+  }
+
+  for (UCustomMovementComponent* Climber : Climbers)
+  {
+    if (!Climber) continue;
+
+    const UClimbProfile* Profile = &Climber->GetClimbProfile();
+    FProfileBatch* ProfileBatch = ProfileBatches.FindByPredicate([Profile](const FProfileBatch& Candidate) { return Candidate.Profile == Profile; });
+    if (!ProfileBatch)
+    {
+      ProfileBatch = &ProfileBatches.AddDefaulted_GetRef();
+      ProfileBatch->Profile = Profile;
+    }
+    ProfileBatch->bInUse = true;
+
+    if (Climber->AddToClimbBatch(ProfileBatch->Batch))
+    {
+      ProfileBatch->Climbers.Add(Climber);
+    }
+  }
+
+  for (FProfileBatch& ProfileBatch : ProfileBatches)
+  {
+    if (ProfileBatch.Climbers.IsEmpty()) continue;
+
+    ClimbSolver::SolveBatch(ProfileBatch.Batch, ProfileBatch.Profile->StopClimbingAngle, ProfileBatch.Profile->FloorReachedSpeed, ProfileBatch.Results);
+
+    for (int32 ClimberIndex = 0; ClimberIndex < ProfileBatch.Climbers.Num(); ClimberIndex++)
+    {
+      ProfileBatch.Climbers[ClimberIndex]->ApplyClimbBatchResult(ProfileBatch.Batch, ProfileBatch.Results, ClimberIndex);
+    }
+  }
+
+  // Profiles no registered climber uses anymore, e.g. after their climbers were destroyed
+  ProfileBatches.RemoveAllSwap([](const FProfileBatch& ProfileBatch) { return !ProfileBatch.bInUse; });
+}
+
+void UClimbBatchSubsystem::SeparateClimbers()
+{
+  SeparationAgents.Reset();
+  SeparationClimbers.Reset();
+
+  for (UCustomMovementComponent* Climber : Climbers)
+  {
+    FClimbSeparationAgent Agent;
+    if (Climber && Climber->GetClimbSeparationAgent(Agent))
+    {
+      SeparationAgents.Add(Agent);
+      SeparationClimbers.Add(Climber);
+    }
+  }
+
+  if (SeparationClimbers.Num() < 2) return;
+
+  SeparationVelocities.SetNumUninitialized(SeparationAgents.Num(), false);
+  ClimbSeparation::ComputeSeparation(SeparationAgents, SeparationVelocities);
+
+  for (int32 ClimberIndex = 0; ClimberIndex < SeparationClimbers.Num(); ClimberIndex++)
+  {
+    SeparationClimbers[ClimberIndex]->ClimbSeparationVelocity = SeparationVelocities[ClimberIndex];
+  }
+}
@@ -0,0 +1,208 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Subsystems/ClimbProbeBudgetSubsystem.h"
+#include "Components/CustomMovementComponent.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+
+static TAutoConsoleVariable<bool> CVarClimbProbeBudget(
+  TEXT("Climber.ProbeBudget"),
+  true,
+  TEXT("Limits the deferrable climb probes issued per frame, see Climber.ProbeBudget.Queries and Climber.ProbeBudget.TimeMs.")
+);
+
+static TAutoConsoleVariable<int32> CVarClimbProbeBudgetQueries(
+  TEXT("Climber.ProbeBudget.Queries"),
+  48,
+  TEXT("Deferrable climb scene queries allowed per frame for climbers that are not player controlled.")
+);
+
+static TAutoConsoleVariable<float> CVarClimbProbeBudgetTimeMs(
+  TEXT("Climber.ProbeBudget.TimeMs"),
+  0.5f,
+  TEXT("Game thread time in milliseconds deferrable climb probes may take per frame before the rest are deferred. 0 disables the time budget.")
+);
+
+static FAutoConsoleCommandWithWorld ClimbProbeBudgetStatsCommand(
+  TEXT("Climber.ProbeBudget.Stats"),
+  TEXT("Reports the climb probe budget overrun counters of the world."),
+  FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* InWorld)
+  {
+    const UClimbProbeBudgetSubsystem* ProbeBudget = InWorld ? InWorld->GetSubsystem<UClimbProbeBudgetSubsystem>() : nullptr;
+    if (!ProbeBudget) return;
+
+    const FClimbProbeBudgetStats& BudgetStats = ProbeBudget->GetStats();
+    UE_LOG(LogClimbing, Log, TEXT("Climb probe budget: %d queries, %d deferred, %.3f ms this frame"),
+      BudgetStats.FrameQueries, BudgetStats.FrameDeferred, BudgetStats.FrameProbeTimeMs);
+    UE_LOG(LogClimbing, Log, TEXT("Climb probe budget: %llu deferred over %llu overrun frames, longest wait %d frames"),
+      BudgetStats.TotalDeferred, BudgetStats.OverrunFrames, BudgetStats.MaxFramesWaiting);
+  })
+);
+
+bool UClimbProbeBudgetSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+  return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+bool UClimbProbeBudgetSubsystem::RunProbe(const UCustomMovementComponent* Requester, int32 QueryCost, TFunctionRef<void()> Probe)
+{
+  UWorld* World = Requester ? Requester->GetWorld() : nullptr;
+  if (UClimbProbeBudgetSubsystem* ProbeBudget = World ? World->GetSubsystem<UClimbProbeBudgetSubsystem>() : nullptr)
+  {
+    return ProbeBudget->TryRunProbe(Requester, QueryCost, Probe);
+  }
+
+  Probe();
+  return true;
+}
+
+bool UClimbProbeBudgetSubsystem::TryRunProbe(const UCustomMovementComponent* Requester, int32 QueryCost, TFunctionRef<void()> Probe)
+{
+  check(IsInGameThread());
+
+  if (!CVarClimbProbeBudget.GetValueOnGameThread())
+  {
+    Probe();
+    return true;
+  }
+
+  if (BudgetFrame != GFrameCounter)
+  {
+    BeginBudgetFrame();
+  }
+
+  FRequesterState& State = Requesters.FindOrAdd(Requester);
+  State.LastRequestFrame = GFrameCounter;
+
+  const ACharacter* CharacterOwner = Requester->GetCharacterOwner();
+  const bool bPlayerControlled = CharacterOwner && CharacterOwner->IsPlayerControlled();
+
+  const float TimeBudgetMs = CVarClimbProbeBudgetTimeMs.GetValueOnGameThread();
+  const bool bOverTimeBudget = TimeBudgetMs > 0.f && Stats.FrameProbeTimeMs >= TimeBudgetMs;
+
+  bool bAllowed = bPlayerControlled;
+  if (!bAllowed && !bOverTimeBudget)
+  {
+    if (State.Granted >= QueryCost)
+    {
+      State.Granted -= QueryCost;
+      bAllowed = true;
+    }
+    else if (UnreservedQueries >= QueryCost)
+    {
+      // Requesters nobody reserved for, e.g. first time ones, take what is left in request order
+      UnreservedQueries -= QueryCost;
+      bAllowed = true;
+    }
+  }
+
+  if (!bAllowed)
+  {
+    State.Demand += QueryCost;
+    Stats.FrameDeferred++;
+    Stats.TotalDeferred++;
+    return false;
+  }
+
+  State.FramesWaiting = 0;
+
+  const double StartTime = FPlatformTime::Seconds();
+  Probe();
+  Stats.FrameProbeTimeMs += (FPlatformTime::Seconds() - StartTime) * 1000.0;
+  Stats.FrameQueries += QueryCost;
+
+  return true;
+}
+
+void UClimbProbeBudgetSubsystem::BeginBudgetFrame()
+{
+  if (Stats.FrameDeferred > 0)
+  {
+    Stats.OverrunFrames++;
+  }
+
+  BudgetFrame = GFrameCounter;
+  Stats.FrameQueries = 0;
+  Stats.FrameDeferred = 0;
+  Stats.FrameProbeTimeMs = 0.0;
+
+  ViewerLocations.Reset();
+  for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+  {
+    if (const APawn* PlayerPawn = It->IsValid() ? (*It)->GetPawn() : nullptr)
+    {
+      ViewerLocations.Add(PlayerPawn->GetActorLocation());
+    }
+  }
+
+  // Last frame's denied requesters get reserved budget in priority order, the rest is first come first served
+  TArray<TPair<float, FRequesterState*>, TInlineAllocator<64>> Waiting;
+
+  for (auto It = Requesters.CreateIterator(); It; ++It)
+  {
+    const UCustomMovementComponent* Requester = It.Key().Get();
+
+    // Requesters that stopped asking, e.g. destroyed or pooled climbers
+    if (!Requester || GFrameCounter - It.Value().LastRequestFrame > 60)
+    {
+      It.RemoveCurrent();
+      continue;
+    }
+
+    FRequesterState& State = It.Value();
+    State.Granted = 0;
+
+    if (State.Demand > 0)
+    {
+      State.FramesWaiting++;
+      Stats.MaxFramesWaiting = FMath::Max(Stats.MaxFramesWaiting, State.FramesWaiting);
+      Waiting.Emplace(GetPriority(Requester, State), &State);
+    }
+  }
+
+  Waiting.Sort([](const TPair<float, FRequesterState*>& A, const TPair<float, FRequesterState*>& B) { return A.Key > B.Key; });
+
+  UnreservedQueries = FMath::Max(CVarClimbProbeBudgetQueries.GetValueOnGameThread(), 0);
+
+  // Only whole demands are reserved, a partial grant could not cover the deferred probes and would sit unspent.
+  // Demands that do not fit leave the budget to smaller ones further down, or to first come first served.
+  for (const TPair<float, FRequesterState*>& WaitingRequester : Waiting)
+  {
+    FRequesterState& State = *WaitingRequester.Value;
+    if (State.Demand <= UnreservedQueries)
+    {
+      State.Granted = State.Demand;
+      UnreservedQueries -= State.Granted;
+    }
+    State.Demand = 0;
+  }
+}
+
+float UClimbProbeBudgetSubsystem::GetPriority(const UCustomMovementComponent* InRequester, const FRequesterState& InState) const
+{
+  // Waiting frames age every requester up so distant climbers are time-sliced rather than starved
+  float Priority = InState.FramesWaiting;
+
+  if (InRequester->HasPendingClimbTransition())
+  {
+    Priority += 10.f;
+  }
+
+  if (!ViewerLocations.IsEmpty())
+  {
+    const FVector RequesterLocation = InRequester->GetOwner()->GetActorLocation();
+
+    float ClosestDistSquared = TNumericLimits<float>::Max();
+    for (const FVector& ViewerLocation : ViewerLocations)
+    {
+      ClosestDistSquared = FMath::Min(ClosestDistSquared, FVector::DistSquared(ViewerLocation, RequesterLocation));
+    }
+
+    // One frame of waiting per 10 meters
+    Priority -= FMath::Sqrt(ClosestDistSquared) / 1000.f;
+  }
+
+  return Priority;
+}
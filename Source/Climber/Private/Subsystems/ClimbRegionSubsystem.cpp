@@ -0,0 +1,20 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Subsystems/ClimbRegionSubsystem.h"
+#include "Volumes/ClimbableRegionVolume.h"
+
+bool UClimbRegionSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+  return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UClimbRegionSubsystem::RegisterRegion(AClimbableRegionVolume* InRegion)
+{
+  Regions.AddUnique(InRegion);
+}
+
+void UClimbRegionSubsystem::UnregisterRegion(AClimbableRegionVolume* InRegion)
+{
+  Regions.RemoveSwap(InRegion);
+}
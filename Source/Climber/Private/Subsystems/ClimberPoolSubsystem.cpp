@@ -0,0 +1,148 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Subsystems/ClimberPoolSubsystem.h"
+#include "Climber/ClimberCharacter.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/Controller.h"
+#include "Engine/World.h"
+
+bool UClimberPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+  return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UClimberPoolSubsystem::Deinitialize()
+{
+  // Pooled climbers are level actors, they go away with the world
+  Pools.Reset();
+
+  Super::Deinitialize();
+}
+
+void UClimberPoolSubsystem::Prewarm(TSubclassOf<AClimberCharacter> ClimberClass, int32 Count)
+{
+  if (!ClimberClass) return;
+
+  FClimberPool& Pool = Pools.FindOrAdd(ClimberClass);
+
+  for (int32 SpawnIndex = 0; SpawnIndex < Count; SpawnIndex++)
+  {
+    AClimberCharacter* Climber = SpawnClimber(ClimberClass, FTransform::Identity);
+    if (!Climber) return;
+
+    DeactivateClimber(Climber, Pool.Inactive.AddDefaulted_GetRef());
+  }
+}
+
+AClimberCharacter* UClimberPoolSubsystem::AcquireClimber(TSubclassOf<AClimberCharacter> ClimberClass, const FTransform& InTransform)
+{
+  if (!ClimberClass) return nullptr;
+
+  if (FClimberPool* Pool = Pools.Find(ClimberClass))
+  {
+    while (!Pool->Inactive.IsEmpty())
+    {
+      const FPooledClimber Pooled = Pool->Inactive.Pop(false);
+
+      // Skips climbers destroyed while pooled, e.g. by a kill volume
+      if (!IsValid(Pooled.Climber)) continue;
+
+      ActivateClimber(Pooled, InTransform);
+      return Pooled.Climber;
+    }
+  }
+
+  return SpawnClimber(ClimberClass, InTransform);
+}
+
+void UClimberPoolSubsystem::ReleaseClimber(AClimberCharacter* Climber)
+{
+  if (!IsValid(Climber)) return;
+
+  FClimberPool& Pool = Pools.FindOrAdd(Climber->GetClass());
+  if (Pool.Inactive.ContainsByPredicate([Climber](const FPooledClimber& Pooled) { return Pooled.Climber == Climber; })) return;
+
+  DeactivateClimber(Climber, Pool.Inactive.AddDefaulted_GetRef());
+}
+
+int32 UClimberPoolSubsystem::GetNumPooled(TSubclassOf<AClimberCharacter> ClimberClass) const
+{
+  const FClimberPool* Pool = Pools.Find(ClimberClass);
+  return Pool ? Pool->Inactive.Num() : 0;
+}
+
+AClimberCharacter* UClimberPoolSubsystem::SpawnClimber(TSubclassOf<AClimberCharacter> ClimberClass, const FTransform& InTransform) const
+{
+  FActorSpawnParameters SpawnParams;
+  SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+  return GetWorld()->SpawnActor<AClimberCharacter>(ClimberClass, InTransform, SpawnParams);
+}
+
+void UClimberPoolSubsystem::DeactivateClimber(AClimberCharacter* Climber, FPooledClimber& OutPooled) const
+{
+  OutPooled.Climber = Climber;
+  OutPooled.Controller = nullptr;
+
+  Climber->ResetClimbState();
+
+  if (AController* Controller = Climber->GetController())
+  {
+    // Players move on to another pawn, AI controllers wait with their climber
+    if (!Controller->IsPlayerController())
+    {
+      OutPooled.Controller = Controller;
+      Controller->SetActorTickEnabled(false);
+    }
+
+    Controller->UnPossess();
+  }
+
+  Climber->GetCharacterMovement()->DisableMovement();
+  Climber->SetActorHiddenInGame(true);
+  Climber->SetActorEnableCollision(false);
+  Climber->SetActorTickEnabled(false);
+
+  for (UActorComponent* Component : Climber->GetComponents())
+  {
+    Component->SetComponentTickEnabled(false);
+  }
+
+  if (Climber->HasAuthority())
+  {
+    Climber->SetNetDormancy(DORM_DormantAll);
+  }
+}
+
+void UClimberPoolSubsystem::ActivateClimber(const FPooledClimber& Pooled, const FTransform& InTransform) const
+{
+  AClimberCharacter* Climber = Pooled.Climber;
+
+  Climber->SetActorTransform(InTransform, false, nullptr, ETeleportType::ResetPhysics);
+  Climber->SetActorHiddenInGame(false);
+  Climber->SetActorEnableCollision(true);
+  Climber->SetActorTickEnabled(true);
+
+  // Ticks enabled on demand, e.g. the climb probe tick, stay off until their owner needs them
+  for (UActorComponent* Component : Climber->GetComponents())
+  {
+    if (Component->PrimaryComponentTick.bStartWithTickEnabled)
+    {
+      Component->SetComponentTickEnabled(true);
+    }
+  }
+
+  Climber->GetCharacterMovement()->SetDefaultMovementMode();
+
+  if (Climber->HasAuthority())
+  {
+    Climber->SetNetDormancy(DORM_Awake);
+  }
+
+  if (IsValid(Pooled.Controller))
+  {
+    Pooled.Controller->SetActorTickEnabled(true);
+    Pooled.Controller->Possess(Climber);
+  }
+}
@@ -0,0 +1,68 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Volumes/ClimbableRegionVolume.h"
+#include "Components/BrushComponent.h"
+#include "Components/CustomMovementComponent.h"
+#include "GameFramework/Character.h"
+#include "Subsystems/ClimbRegionSubsystem.h"
+
+static UCustomMovementComponent* GetClimbMovement(AActor* InActor)
+{
+  const ACharacter* Character = Cast<ACharacter>(InActor);
+  return Character ? Cast<UCustomMovementComponent>(Character->GetCharacterMovement()) : nullptr;
+}
+
+AClimbableRegionVolume::AClimbableRegionVolume(const FObjectInitializer& ObjectInitializer)
+  : Super(ObjectInitializer)
+{
+  // Only overlaps, so it never changes how anything moves or is traced
+  GetBrushComponent()->SetCollisionProfileName(TEXT("Trigger"));
+  GetBrushComponent()->SetGenerateOverlapEvents(true);
+
+  // Characters placed inside a region when the level loads need their begin overlap too
+  bGenerateOverlapEventsDuringLevelStreaming = true;
+
+  bColored = true;
+  BrushColor = FColor(100, 200, 255, 255);
+}
+
+void AClimbableRegionVolume::BeginPlay()
+{
+  Super::BeginPlay();
+
+  if (UClimbRegionSubsystem* ClimbRegionSubsystem = GetWorld()->GetSubsystem<UClimbRegionSubsystem>())
+  {
+    ClimbRegionSubsystem->RegisterRegion(this);
+  }
+}
+
+void AClimbableRegionVolume::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+  if (UClimbRegionSubsystem* ClimbRegionSubsystem = GetWorld()->GetSubsystem<UClimbRegionSubsystem>())
+  {
+    ClimbRegionSubsystem->UnregisterRegion(this);
+  }
+
+  Super::EndPlay(EndPlayReason);
+}
+
+void AClimbableRegionVolume::NotifyActorBeginOverlap(AActor* OtherActor)
+{
+  Super::NotifyActorBeginOverlap(OtherActor);
+
+  if (UCustomMovementComponent* CustomMovementComponent = GetClimbMovement(OtherActor))
+  {
+    CustomMovementComponent->EnterClimbableRegion(this);
+  }
+}
+
+void AClimbableRegionVolume::NotifyActorEndOverlap(AActor* OtherActor)
+{
+  Super::NotifyActorEndOverlap(OtherActor);
+
+  if (UCustomMovementComponent* CustomMovementComponent = GetClimbMovement(OtherActor))
+  {
+    CustomMovementComponent->ExitClimbableRegion(this);
+  }
+}
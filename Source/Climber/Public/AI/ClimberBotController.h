@@ -0,0 +1,60 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AIController.h"
+#include "ClimberBotController.generated.h"
+
+class UCustomMovementComponent;
+
+/**
+ * Scripted climber used by generated stress maps. Walks into the wall in front of it, climbs with a seeded
+ * weave and hop pattern, lets go and starts over, so scenarios are repeatable for a given seed.
+ */
+UCLASS()
+class CLIMBER_API AClimberBotController : public AAIController
+{
+  GENERATED_BODY()
+
+public:
+  AClimberBotController();
+
+  virtual void Tick(float DeltaTime) override;
+
+  // Bots spawned at the same location with the same seed replay the same inputs
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Climbing Bot")
+  int32 Seed = 0;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Climbing Bot")
+  float ClimbAttemptInterval = 0.5f;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Climbing Bot")
+  FVector2D ClimbDurationRange = FVector2D(3.f, 8.f);
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Climbing Bot")
+  FVector2D HopIntervalRange = FVector2D(1.f, 3.f);
+
+  // Seconds for a full left to right sweep while climbing
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Climbing Bot")
+  float WeavePeriod = 4.f;
+
+protected:
+  virtual void OnPossess(APawn* InPawn) override;
+  virtual void OnUnPossess() override;
+
+private:
+  void TickGround(float DeltaTime);
+  void TickClimbing(float DeltaTime);
+
+  UPROPERTY()
+  UCustomMovementComponent* BotMovementComponent;
+
+  FRandomStream RandomStream;
+
+  float TimeUntilClimbAttempt = 0.f;
+  float TimeUntilLetGo = 0.f;
+  float TimeUntilHop = 0.f;
+  float WeavePhase = 0.f;
+  bool bWasClimbing = false;
+};
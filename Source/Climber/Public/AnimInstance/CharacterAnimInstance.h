@@ -4,10 +4,13 @@
 
 #include "CoreMinimal.h"
 #include "Animation/AnimInstance.h"
+#include "Climber/ClimbLatency.h"
 #include "CharacterAnimInstance.generated.h"
 
 class AClimberCharacter;
 class UCustomMovementComponent;
+class UClimbIKComponent;
+struct FClimbAnimSnapshot;
 /**
  *
  */
@@ -18,7 +21,7 @@ class CLIMBER_API UCharacterAnimInstance : public UAnimInstance
 
 public:
 	virtual void NativeInitializeAnimation() override;
-	virtual void NativeUpdateAnimation(float DeltaSeconds) override;
+	virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
 
 private:
 	UPROPERTY()
@@ -27,27 +30,50 @@ private:
 	UPROPERTY()
 	UCustomMovementComponent* CustomMovementComponent;
 
+	UPROPERTY()
+	UClimbIKComponent* ClimbIKComponent;
+
+	// Last input stamp whose pose latency was recorded, so each input is counted once
+	FClimbInputStamp LastPosedInputStamp;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Reference, meta = (AllowPrivateAccess = "true"))
 	float GroundSpeed;
-	void GetGroundSpeed();
+	void GetGroundSpeed(const FClimbAnimSnapshot& Snapshot);
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Reference, meta = (AllowPrivateAccess = "true"))
 	float AirSpeed;
-	void GetAirSpeed();
+	void GetAirSpeed(const FClimbAnimSnapshot& Snapshot);
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Reference, meta = (AllowPrivateAccess = "true"))
 	bool bShouldMove;
-	void GetShouldMove();
+	void GetShouldMove(const FClimbAnimSnapshot& Snapshot);
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Reference, meta = (AllowPrivateAccess = "true"))
 	bool bIsFalling;
-	void GetIsFalling();
+	void GetIsFalling(const FClimbAnimSnapshot& Snapshot);
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Reference, meta = (AllowPrivateAccess = "true"))
 	bool bIsClimbing;
-	void GetIsClimbing();
+	void GetIsClimbing(const FClimbAnimSnapshot& Snapshot);
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Reference, meta = (AllowPrivateAccess = "true"))
 	FVector ClimbVelocity;
-	void GetClimbVelocity();
+	void GetClimbVelocity(const FClimbAnimSnapshot& Snapshot);
+
+	// World space limb targets on the climbed surface, read on the anim thread
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Climbing IK", meta = (AllowPrivateAccess = "true"))
+	FVector LeftHandIKLocation;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Climbing IK", meta = (AllowPrivateAccess = "true"))
+	FVector RightHandIKLocation;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Climbing IK", meta = (AllowPrivateAccess = "true"))
+	FVector LeftFootIKLocation;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Climbing IK", meta = (AllowPrivateAccess = "true"))
+	FVector RightFootIKLocation;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Climbing IK", meta = (AllowPrivateAccess = "true"))
+	float ClimbIKAlpha;
+	void GetClimbIKTargets();
 };
\ No newline at end of file
@@ -0,0 +1,11 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Trace channel only blocked by geometry marked as climbable, see [/Script/Engine.CollisionProfile] in DefaultEngine.ini
+#define ECC_Climbable ECC_GameTraceChannel1
+
+// Collision profile for climbable level geometry, WorldStatic that also blocks ECC_Climbable
+#define CLIMBABLE_SURFACE_PROFILE TEXT("ClimbableSurface")
@@ -0,0 +1,108 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Engine/EngineTypes.h"
+#include "WorldCollision.h"
+#include "ClimbIKComponent.generated.h"
+
+class UCustomMovementComponent;
+
+UENUM(BlueprintType)
+enum class EClimbLimb : uint8
+{
+  LeftHand,
+  RightHand,
+  LeftFoot,
+  RightFoot,
+  Num UMETA(Hidden)
+};
+
+// World space hand and foot targets, copied out for the anim thread
+USTRUCT()
+struct FClimbIKTargets
+{
+  GENERATED_BODY()
+
+  FVector Locations[static_cast<int32>(EClimbLimb::Num)] = {};
+  FVector Normals[static_cast<int32>(EClimbLimb::Num)] = {};
+
+  // Blends IK in while climbing and out otherwise
+  float Alpha = 0.f;
+
+  FORCEINLINE const FVector& GetLocation(EClimbLimb InLimb) const { return Locations[static_cast<int32>(InLimb)]; }
+};
+
+/**
+ * Places hands and feet on the climbed surface from the contacts the movement component already gathered.
+ * Limbs whose estimate moved get one refinement line trace each, issued together as async traces.
+ */
+UCLASS(ClassGroup = (Climbing), meta = (BlueprintSpawnableComponent))
+class CLIMBER_API UClimbIKComponent : public UActorComponent
+{
+  GENERATED_BODY()
+
+public:
+  UClimbIKComponent();
+
+  virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+  // Safe to call from worker threads, e.g. NativeThreadSafeUpdateAnimation
+  FClimbIKTargets GetIKTargets() const;
+
+  // Drops all limb targets, IK blends in from scratch on the next climb
+  void ResetIKTargets();
+
+protected:
+  virtual void BeginPlay() override;
+
+private:
+  FVector EstimateLimbTarget(EClimbLimb InLimb, FVector& OutNormal) const;
+  void RequestRefinement(EClimbLimb InLimb, const FVector& InEstimate, const FVector& InNormal);
+  void OnRefinementTraceDone(const FTraceHandle& InTraceHandle, FTraceDatum& InTraceDatum);
+
+  UPROPERTY()
+  UCustomMovementComponent* MovementComponent;
+
+  struct FLimbState
+  {
+    FVector Estimate = FVector::ZeroVector;
+    FVector EstimateNormal = FVector::ForwardVector;
+
+    // Estimate the last refinement trace was issued for
+    FVector RefinedFrom = FVector::ZeroVector;
+    FVector RefinedLocation = FVector::ZeroVector;
+    FVector RefinedNormal = FVector::ForwardVector;
+    bool bRefined = false;
+    bool bRefinementPending = false;
+  };
+
+  FLimbState LimbStates[static_cast<int32>(EClimbLimb::Num)];
+
+  FTraceDelegate RefinementTraceDelegate;
+
+  mutable FRWLock IKTargetsLock;
+  FClimbIKTargets IKTargets;
+
+  // Limb rest positions in the climber's local space, X into the wall
+  UPROPERTY(EditDefaultsOnly, Category = "Climbing IK", meta = (AllowPrivateAccess = "true"))
+  FVector LimbOffsets[static_cast<int32>(EClimbLimb::Num)] = {
+    FVector(0.f, -25.f, 60.f),
+    FVector(0.f, 25.f, 60.f),
+    FVector(0.f, -15.f, -60.f),
+    FVector(0.f, 15.f, -60.f)
+  };
+
+  // A limb is traced again once its estimate moved this far from the last refinement
+  UPROPERTY(EditDefaultsOnly, Category = "Climbing IK", meta = (AllowPrivateAccess = "true"))
+  float RefineDistance = 15.f;
+
+  // Refinement traces start and end this far off the estimated surface
+  UPROPERTY(EditDefaultsOnly, Category = "Climbing IK", meta = (AllowPrivateAccess = "true"))
+  float RefineTraceDepth = 30.f;
+
+  UPROPERTY(EditDefaultsOnly, Category = "Climbing IK", meta = (AllowPrivateAccess = "true"))
+  float AlphaInterpSpeed = 8.f;
+};
@@ -0,0 +1,65 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/SpringArmComponent.h"
+#include "ClimbSpringArmComponent.generated.h"
+
+class UCustomMovementComponent;
+
+/**
+ * Spring arm with a climb camera mode. While climbing it swings the arm origin off the climbed surface
+ * and replaces the per-frame collision sweep with a probe that ignores the climbed components, run at a reduced rate while the arm is clear.
+ */
+UCLASS(ClassGroup = (Climbing), meta = (BlueprintSpawnableComponent))
+class CLIMBER_API UClimbSpringArmComponent : public USpringArmComponent
+{
+  GENERATED_BODY()
+
+public:
+  void SetClimbCameraMode(bool bEnable);
+  FORCEINLINE bool IsInClimbCameraMode() const { return bClimbCameraMode; }
+
+protected:
+  virtual void BeginPlay() override;
+  virtual void UpdateDesiredArmLocation(bool bDoTrace, bool bDoLocationLag, bool bDoRotationLag, float DeltaTime) override;
+
+private:
+  void UpdateClimbSurfaceOffset(float DeltaTime);
+  void ProbeClimbArmLength();
+
+  UPROPERTY()
+  UCustomMovementComponent* MovementComponent;
+
+  bool bClimbCameraMode = false;
+
+  // Arm settings outside of the climb camera mode, restored on exit
+  FVector WalkTargetOffset = FVector::ZeroVector;
+  float WalkTargetArmLength = 0.f;
+
+  // 0 to 1, blends the surface offset in on enter and out on exit
+  float ClimbSurfaceOffsetAlpha = 0.f;
+  FVector ClimbSurfaceNormal = FVector::ZeroVector;
+
+  float ClimbProbedArmLength = 0.f;
+  float TimeSinceClimbProbe = 0.f;
+
+  // The last probe hit something, probe every frame until the arm is clear again
+  bool bClimbProbeBlocked = false;
+
+  // World space distance the arm origin is pushed off the climbed surface
+  UPROPERTY(EditAnywhere, Category = "Camera Climbing", meta = (AllowPrivateAccess = "true"))
+  float ClimbSurfaceOffset = 80.f;
+
+  UPROPERTY(EditAnywhere, Category = "Camera Climbing", meta = (AllowPrivateAccess = "true"))
+  float ClimbSurfaceOffsetInterpSpeed = 4.f;
+
+  // Seconds between collision probes while climbing with a clear arm, a blocked arm is probed every frame
+  UPROPERTY(EditAnywhere, Category = "Camera Climbing", meta = (AllowPrivateAccess = "true", ClampMin = "0.0"))
+  float ClimbProbeInterval = 0.1f;
+
+  // Lengthening is smoothed, shortening snaps so the camera doesn't clip into geometry between probes
+  UPROPERTY(EditAnywhere, Category = "Camera Climbing", meta = (AllowPrivateAccess = "true"))
+  float ClimbArmLengthInterpSpeed = 3.f;
+};
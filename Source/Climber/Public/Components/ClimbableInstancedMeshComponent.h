@@ -0,0 +1,61 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "PhysicalMaterials/ClimbPhysicalMaterial.h"
+#include "ClimbableInstancedMeshComponent.generated.h"
+
+USTRUCT(BlueprintType)
+struct FClimbInstanceData
+{
+  GENERATED_BODY()
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Climbing")
+  FClimbSurfaceProperties Surface;
+
+  // Climbing up to the top of this instance, or down from it, is allowed
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Climbing")
+  bool bLedge = true;
+
+  // This instance can be vaulted over
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Climbing")
+  bool bVaultTarget = true;
+};
+
+/**
+ * Hierarchical instanced static mesh with climb metadata per instance, read from the instance index of climb trace hits.
+ * Hierarchical so large instance counts keep culling, it still works wherever a plain instanced mesh would.
+ */
+UCLASS(ClassGroup = Rendering, meta = (BlueprintSpawnableComponent))
+class CLIMBER_API UClimbableInstancedMeshComponent : public UHierarchicalInstancedStaticMeshComponent
+{
+  GENERATED_BODY()
+
+public:
+  // Used by instances past the end of PerInstanceClimbData
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Climbing")
+  FClimbInstanceData DefaultClimbData;
+
+  // Same order as the instances, kept in sync with every removal, swap and clear through OnInstanceIndexUpdated
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Climbing")
+  TArray<FClimbInstanceData> PerInstanceClimbData;
+
+  const FClimbInstanceData& GetInstanceClimbData(int32 InstanceIndex) const;
+
+  UFUNCTION(BlueprintCallable, Category = "Climbing")
+  void SetInstanceClimbData(int32 InstanceIndex, const FClimbInstanceData& InClimbData);
+
+  // Climb metadata of the instance a hit landed on, null when the hit is not on a climbable instanced mesh
+  static const FClimbInstanceData* FindInstanceClimbData(const FHitResult& InHit);
+
+  virtual void PostInitProperties() override;
+  virtual void BeginDestroy() override;
+
+private:
+  // Mirrors the engine instance index changes, the only place that sees remove at swap and the HISM reorders
+  void OnInstanceIndexUpdated(UInstancedStaticMeshComponent* InComponent, TArrayView<const FInstancedStaticMeshDelegates::FInstanceIndexUpdateData> InIndexUpdates);
+
+  FDelegateHandle InstanceIndexUpdatedHandle;
+};
@@ -4,14 +4,30 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/NetSerialization.h"
+#include "ClimbContact.h"
+#include "ClimbBatchSolver.h"
+#include "ClimbSimulation.h"
+#include "ClimbSeparation.h"
+#include "ClimberCollision.h"
+#include "PhysicalMaterials/ClimbPhysicalMaterial.h"
+#include "Climber/ClimbLatency.h"
 #include "CustomMovementComponent.generated.h"
 
+CLIMBER_API DECLARE_LOG_CATEGORY_EXTERN(LogClimbing, Log, All);
+LLM_DECLARE_TAG_API(Climbing, CLIMBER_API);
+
 DECLARE_DELEGATE(FOnEnterClimbState)
 DECLARE_DELEGATE(FOnExitClimbState)
 
 class UAnimMontage;
 class UAnimInstance;
 class AClimberCharacter;
+class FClimbAsyncCallback;
+class UClimbProfile;
+class AClimbableRegionVolume;
 
 UENUM(BlueprintType)
 namespace ECustomMovementMode
@@ -22,12 +38,136 @@ namespace ECustomMovementMode
   };
 }
 
+// Transform the climb probes are traced from, the updated component one for a live character
+struct FClimbProbeFrame
+{
+  FVector Location = FVector::ZeroVector;
+  FQuat Rotation = FQuat::Identity;
+  float EyeHeight = 0.f;
+  float CapsuleHalfHeight = 0.f;
+
+  FORCEINLINE FVector GetForwardVector() const { return Rotation.GetForwardVector(); }
+  FORCEINLINE FVector GetUpVector() const { return Rotation.GetUpVector(); }
+};
+
+// What a climb probe traces against
+enum class EClimbTraceTarget : uint8
+{
+  // Only geometry blocking the Climbable channel, for the surfaces the character holds on to
+  ClimbableSurfaces,
+
+  // Any geometry of the world trace object type, for floors, ledge tops and landings that need not be climbable
+  World
+};
+
+// Climb montage transitions, replicated to simulated proxies so they can play them locally
+UENUM()
+enum class EClimbTransition : uint8
+{
+  None,
+  IdleToClimb,
+  ClimbToTop,
+  ClimbDownLedge,
+  Vault,
+  HopUp,
+  HopDown,
+  InnerCornerWrap,
+  OuterCornerWrap,
+  Num UMETA(Hidden)
+};
+
+// Climb state simulated proxies need for movement and animation, replaces ReplicatedMovement while climbing.
+// Rotation is not sent, climbers face into the surface so proxies derive it from the normal.
+USTRUCT()
+struct FClimbReplicatedState
+{
+  GENERATED_BODY()
+
+  bool bClimbing = false;
+
+  // Rounded to whole centimeters like ReplicatedMovement, proxies smooth the mesh over the difference
+  FVector_NetQuantize Location = FVector::ZeroVector;
+
+  // Unit surface normal, each component scaled to int8
+  int8 SurfaceNormal[3] = { 0, 0, 0 };
+
+  // Climb velocity along the surface in the climber's local space, in cm/s. Local X points into the wall and is dropped.
+  int16 LocalVelocityY = 0;
+  int16 LocalVelocityZ = 0;
+
+  // Low 4 bits hold the EClimbTransition, the high bits a sequence so replaying the same transition is still noticed
+  uint8 TransitionId = 0;
+
+  void SetSurfaceNormal(const FVector& InNormal);
+  FVector GetSurfaceNormal() const;
+
+  void SetLocalVelocity(const FVector& InLocalVelocity);
+  FVector GetLocalVelocity() const;
+
+  FORCEINLINE EClimbTransition GetTransition() const { return static_cast<EClimbTransition>(TransitionId & 0xF); }
+
+  bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+  bool operator==(const FClimbReplicatedState& Other) const;
+};
+
+template<>
+struct TStructOpsTypeTraits<FClimbReplicatedState> : public TStructOpsTypeTraitsBase2<FClimbReplicatedState>
+{
+  enum
+  {
+    WithNetSerializer = true,
+    WithIdenticalViaEquality = true
+  };
+};
+
+class UCustomMovementComponent;
+
+// Runs the per frame climb probes on any thread, ahead of the movement tick that consumes them
+USTRUCT()
+struct FClimbProbeTickFunction : public FTickFunction
+{
+  GENERATED_BODY()
+
+  UCustomMovementComponent* Target = nullptr;
+
+  virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+  virtual FString DiagnosticMessage() override;
+  virtual FName DiagnosticContext(bool bDetailed) override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FClimbProbeTickFunction> : public TStructOpsTypeTraitsBase2<FClimbProbeTickFunction>
+{
+  enum
+  {
+    WithCopy = false
+  };
+};
+
+// Movement state as of the end of this frame's movement tick, the only climb state animation reads
+struct FClimbAnimSnapshot
+{
+  FVector Velocity = FVector::ZeroVector;
+  FVector Acceleration = FVector::ZeroVector;
+  FVector ClimbVelocity = FVector::ZeroVector;
+  bool bIsClimbing = false;
+  bool bIsFalling = false;
+
+  // Frame the snapshot was published on
+  uint64 Frame = 0;
+
+  // Oldest climb input this movement tick consumed, unset when it consumed none
+  FClimbInputStamp InputStamp;
+};
+
 UCLASS()
 class CLIMBER_API UCustomMovementComponent : public UCharacterMovementComponent
 {
   GENERATED_BODY()
 
 public:
+  UCustomMovementComponent();
+
   FOnEnterClimbState OnEnterClimbStateDelegate;
   FOnExitClimbState OnExitClimbStateDelegate;
 
@@ -35,29 +175,57 @@ protected:
 
 #pragma region OverridenFunctions
   virtual void BeginPlay() override;
+  virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+  virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
   virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+  virtual void RegisterComponentTickFunctions(bool bRegister) override;
   virtual void OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode) override;
   virtual void PhysCustom(float deltaTime, int32 Iterations) override;
   virtual float GetMaxSpeed() const override;
   virtual float GetMaxAcceleration() const override;
+  virtual FVector ScaleInputAcceleration(const FVector& InputAcceleration) const override;
   virtual FVector ConstrainAnimRootMotionVelocity(const FVector& RootMotionVelocity, const FVector& CurrentVelocity) const override;
+  virtual void TickCharacterPose(float DeltaTime) override;
 #pragma endregion
 
 private:
 
 #pragma region ClimbTraces
 
-  TArray<FHitResult> DoCapsuleTraceMultiByObject(const FVector& Start, const FVector& End, bool bShowDebugShape = false, bool bDrawPersistentShapes = false);
-  FHitResult DoLineTraceSingleByObject(const FVector& Start, const FVector& End, bool bShowDebugShape = false, bool bDrawPersistentShapes = false);
+  TArray<FHitResult> DoCapsuleTraceMulti(const FVector& Start, const FVector& End, EClimbTraceTarget InTarget, bool bShowDebugShape = false, bool bDrawPersistentShapes = false) const;
+  FHitResult DoLineTraceSingle(const FVector& Start, const FVector& End, EClimbTraceTarget InTarget, bool bShowDebugShape = false, bool bDrawPersistentShapes = false) const;
+  FHitResult DoSphereTraceSingle(const FVector& Start, const FVector& End, float Radius, EClimbTraceTarget InTarget, bool bShowDebugShape = false, bool bDrawPersistentShapes = false) const;
+  TArray<TEnumAsByte<EObjectTypeQuery>> GetWorldTraceObjectTypes() const;
 
 #pragma endregion
 
 #pragma region ClimbCore
 
+  struct FClimbContactComponent
+  {
+    TWeakObjectPtr<UPrimitiveComponent> Component;
+
+    // Instance of a climbable instanced mesh, INDEX_NONE for any other component
+    int32 InstanceIndex;
+
+    // Contacts on differently surfaced parts of one component get their own slot
+    TWeakObjectPtr<const UPhysicalMaterial> PhysicalMaterial;
+
+    FClimbSurfaceProperties Surface;
+  };
+
   bool TraceClimbableSurfaces();
-  FHitResult TraceFromEyeHeight(float TraceDistance, float TraceStartOffset = 0.f, bool bShowDebugShape = false, bool bDrawPersistantShapes = false);
+  void StoreClimbContacts(const TArray<FHitResult>& InSurfaceHits, const FVector& InOrigin);
 
-  bool CanClimbDownLedge();
+  // Quantizes climbable surface hits into contacts and the components they reference, dropping non climbable ones
+  static void ReduceClimbContacts(const TArray<FHitResult>& InSurfaceHits, const FVector& InOrigin,
+    TMap<TWeakObjectPtr<const UPhysicalMaterial>, FClimbSurfaceProperties>* InSurfaceCache,
+    TArray<FClimbContact, TFixedAllocator<MaxClimbContacts> >& OutContacts,
+    TArray<FClimbContactComponent, TFixedAllocator<MaxClimbContacts> >& OutContactComponents);
+
+  // The one climbability filter of climb contacts and start probes: per instance metadata on climbable instanced meshes, else the hit physical material.
+  // Physical material lookups go through InSurfaceCache when given, probes that may run off the game thread pass none.
+  static FClimbSurfaceProperties ResolveHitSurface(const FHitResult& InHit, TMap<TWeakObjectPtr<const UPhysicalMaterial>, FClimbSurfaceProperties>* InSurfaceCache = nullptr);
 
   bool CanStartClimbing();
 
@@ -72,6 +240,33 @@ private:
   bool CheckShouldStopClimbing();
 
   bool CheckHasReachedFloor();
+  void SweepFloor(const FClimbProbeFrame& InFrame, TArray<FHitResult>& OutFloorHits) const;
+
+  // Up component of the floor hit normal closest to vertical, all the floor check needs from the hits, 0 without hits
+  static float ReduceFloorHits(const TArray<FHitResult>& InFloorHits);
+
+  friend struct FClimbProbeTickFunction;
+
+  // Traces from the snapshot taken at the end of the last PhysClimb, called by ClimbProbeTickFunction on any thread
+  void RunClimbProbes();
+
+  // Probe results traced from where the character still is, PhysClimb traces again on the game thread otherwise
+  bool HasCurrentClimbProbeResults() const;
+
+  // Physics thread probes, only used when the physics scene runs async
+  void RegisterClimbAsyncCallback();
+  void UnregisterClimbAsyncCallback();
+  void ConsumeClimbAsyncOutputs();
+  void SendClimbAsyncInput(bool bClimbing);
+
+  friend class UClimbBatchSubsystem;
+
+  // Stores the probe tick contacts and adds them to the batch, false when this climber has nothing current to solve
+  bool AddToClimbBatch(FClimbSolverBatch& Batch);
+  void ApplyClimbBatchResult(const FClimbSolverBatch& Batch, const FClimbSolverBatchResults& Results, int32 BatchIndex);
+
+  // False while not climbing on anything or while a transition moves the climber
+  bool GetClimbSeparationAgent(FClimbSeparationAgent& OutAgent) const;
 
   FQuat GetClimbRotation(float deltaTime);
 
@@ -81,25 +276,62 @@ private:
 
   void TryStartVaulting();
 
-  bool CanStartVaulting(FVector& OutVaultStartPosition, FVector& OutVaultLandPosition);
+  void PlayClimbMontage(EClimbTransition InTransition);
+  const TSoftObjectPtr<UAnimMontage>& GetTransitionMontage(EClimbTransition InTransition) const;
 
-  void PlayClimbMontage(UAnimMontage* MontageToPlay);
+  void UpdateClimbMontagesPreload(float DeltaTime);
 
   UFUNCTION()
   void OnClimbMontageEnded(UAnimMontage* Montage, bool bInterrupted);
 
+#if WITH_EDITOR
+  // Live reload of profile edits made during PIE
+  void OnClimbProfileChanged(const UClimbProfile* InProfile);
+  FDelegateHandle ClimbProfileChangedHandle;
+#endif
+
   void SetMotionWarpTarget(const FName& InWarpTargetName, const FVector& InTargetPosition);
+  void SetMotionWarpTarget(const FName& InWarpTargetName, const FVector& InTargetPosition, const FQuat& InTargetRotation);
+
+  // Wraps around a corner found in the contact spread instead of letting the averaged normal swing across it
+  void TryStartCornerWrap();
 
   void HandleHopUp();
   void HandleHopDown();
 
-  bool CheckCanHopUp(FVector& OutHopUpTargetPosition);
-  bool CheckCanHopDown(FVector& OutHopDownTargetPosition);
+  void RefreshHopCandidates(float deltaTime);
+  void UpdateHopCandidates();
+
+  // Server side, keeps the proxy climb state current and throttles replication of climbers hanging still
+  void UpdateClimbReplicatedState();
+  void UpdateClimbMovementReplication();
+  void UpdateClimbNetIdle(float DeltaTime);
+
+  // Proxy side, moves the climber to the replicated climb state the way ReplicatedMovement would
+  void ApplyClimbReplicatedMovement();
+
+  UFUNCTION()
+  void OnRep_ClimbReplicatedState(const FClimbReplicatedState& PreviousState);
+
+  // bAfterMove is false when published ahead of the move, pending input is only recorded once it has moved the character
+  void PublishClimbAnimSnapshot(bool bAfterMove = true);
 #pragma endregion
 
 #pragma region ClimbVariables
 
-  TArray<FHitResult> ClimbableSurfacesTracedResults;
+  // Quantized contacts of the last climbable surface trace, relative to ClimbContactsOrigin
+  TArray<FClimbContact, TFixedAllocator<MaxClimbContacts> > ClimbContacts;
+
+  // Components referenced by FClimbContact::ComponentIndex
+  TArray<FClimbContactComponent, TFixedAllocator<MaxClimbContacts> > ClimbContactComponents;
+
+  FVector ClimbContactsOrigin;
+
+  // Surface properties resolved once per contacted physical material, emptied when leaving the climb state
+  TMap<TWeakObjectPtr<const UPhysicalMaterial>, FClimbSurfaceProperties> ClimbSurfaceCache;
+
+  // Contact weighted surface properties of the surface being climbed
+  FClimbSurfaceProperties CurrentClimbableSurfaceProperties;
 
   FVector CurrentClimbableSurfaceLocation;
 
@@ -107,51 +339,103 @@ private:
 
   UPROPERTY()
   UAnimInstance* OwningPlayerAnimInstance;
-#pragma endregion
 
-#pragma region ClimbBPVariables
+  // Hop target found by the last candidate refresh, stored relative to the updated component
+  struct FClimbHopCandidate
+  {
+    bool bValid = false;
+    FVector LocalTargetPosition = FVector::ZeroVector;
+  };
 
-  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement: Climbing", meta = (AllowPrivateAccess = "true"))
-  TArray<TEnumAsByte<EObjectTypeQuery> > ClimbableSurfaceTraceTypes;
+  // Set while a corner wrap montage moves the climber onto the next face, climbing cannot stop meanwhile
+  bool bCornerWrapping = false;
 
-  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement: Climbing", meta = (AllowPrivateAccess = "true"))
-  float ClimbCapsuleTraceRadius = 50.f;
+  FClimbHopCandidate HopUpCandidate;
+  FClimbHopCandidate HopDownCandidate;
 
-  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement: Climbing", meta = (AllowPrivateAccess = "true"))
-  float ClimbCapsuleTraceHalfHeight = 72.f;
+  bool bHopCandidatesDirty = true;
+  float TimeSinceHopCandidatesRefresh = 0.f;
+  FVector HopCandidatesRefreshLocation;
 
-  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement: Climbing", meta = (AllowPrivateAccess = "true"))
-  float MaxBreakCLimbDeceleration = 400.0f;
+  FClimbProbeTickFunction ClimbProbeTickFunction;
 
-  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement: Climbing", meta = (AllowPrivateAccess = "true"))
-  float MaxClimbSpeed = 100.0f;
+  // Hits are reduced before the probes return, so no hit results are kept between ticks
+  struct FClimbProbeResults
+  {
+    FClimbProbeFrame Frame;
+    TArray<FClimbContact, TFixedAllocator<MaxClimbContacts> > Contacts;
+    TArray<FClimbContactComponent, TFixedAllocator<MaxClimbContacts> > ContactComponents;
+    FVector ContactsOrigin = FVector::ZeroVector;
+    float FloorNormalZ = 0.f;
+    bool bValid = false;
+
+    // Physics thread results lag the game thread by up to a physics step, so they are matched with a tolerance
+    bool bFromAsyncPhysics = false;
+  };
 
-  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement: Climbing", meta = (AllowPrivateAccess = "true"))
-  float MaxClimbAcceleration = 300.0f;
+  // Written by ClimbProbeTickFunction, which the movement tick depends on, so PhysClimb reads it once it is complete
+  FClimbProbeResults ClimbProbeResults;
 
-  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement: Climbing", meta = (AllowPrivateAccess = "true"))
-  float ClimbDownWalkableSurfaceTraceOffset = 100.f;
+  struct FClimbBatchedSolve
+  {
+    FVector Location = FVector::ZeroVector;
+    FVector Normal = FVector::ZeroVector;
+    FQuat TargetRotation = FQuat::Identity;
+    bool bShouldStop = false;
+    bool bFloorReached = false;
+    bool bValid = false;
+  };
 
-  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement: Climbing", meta = (AllowPrivateAccess = "true"))
-  float ClimbDownLedgeTraceOffset = 50.f;
+  // Written by the batch subsystem tick between ClimbProbeTickFunction and the movement tick
+  FClimbBatchedSolve BatchedClimbSolve;
 
-  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement: Climbing", meta = (AllowPrivateAccess = "true"))
-  UAnimMontage* IdleToClimbMontage;
+  // Surface space push away from nearby climbers on the same wall, also written by the batch subsystem tick.
+  // Locally controlled climbers turn it into acceleration, so it reaches the server inside their saved moves.
+  FVector ClimbSeparationVelocity = FVector::ZeroVector;
 
-  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement: Climbing", meta = (AllowPrivateAccess = "true"))
-  UAnimMontage* ClimbToTopMontage;
+  // Carries the frame time left over from the fixed climb steps, see Climber.FixedStepRate
+  FClimbFixedStepper ClimbFixedStepper;
 
-  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement: Climbing", meta = (AllowPrivateAccess = "true"))
-  UAnimMontage* ClimbDownLedgeMontage;
+  FClimbProbeFrame ClimbProbeSnapshot;
+  bool bHasClimbProbeSnapshot = false;
 
-  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement: Climbing", meta = (AllowPrivateAccess = "true"))
-  UAnimMontage* VaultMontage;
+  // Written at the end of the movement tick, read by the anim worker threads after it
+  FClimbAnimSnapshot ClimbAnimSnapshot;
+  mutable FRWLock ClimbAnimSnapshotLock;
 
-  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement: Climbing", meta = (AllowPrivateAccess = "true"))
-  UAnimMontage* HopUpMontage;
+  // Set by the first climb input since the last movement tick
+  FClimbInputStamp PendingClimbInputStamp;
+
+  // Climbable regions the character overlaps, kept by their begin and end overlap events
+  TArray<TWeakObjectPtr<const AClimbableRegionVolume>, TInlineAllocator<2>> OverlappedClimbableRegions;
+
+  UPROPERTY(ReplicatedUsing = OnRep_ClimbReplicatedState)
+  FClimbReplicatedState ClimbReplicatedState;
 
+  uint8 ClimbTransitionSequence = 0;
+
+  float ClimbNetIdleTime = 0.f;
+  bool bClimbNetIdle = false;
+  bool bClimbNetDormant = false;
+
+  // ReplicatedMovement of the owner is off while the climb state carries the movement
+  bool bClimbMovementReplicationCut = false;
+  float ClimbActiveNetUpdateFrequency = 0.f;
+
+  // Owned by the physics solver, freed through UnregisterClimbAsyncCallback
+  FClimbAsyncCallback* ClimbAsyncCallback = nullptr;
+
+  // Keeps the climb montages loaded while climbable geometry is near
+  TSharedPtr<FStreamableHandle> ClimbMontagesHandle;
+  float TimeSinceClimbMontagesPreloadCheck = 0.f;
+  float TimeAwayFromClimbableGeometry = 0.f;
+#pragma endregion
+
+#pragma region ClimbBPVariables
+
+  // Shared tuning and montages, the UClimbProfile class default object when unset
   UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement: Climbing", meta = (AllowPrivateAccess = "true"))
-  UAnimMontage* HopDownMontage;
+  TObjectPtr<UClimbProfile> ClimbProfile;
 
   UPROPERTY()
   AClimberCharacter* OwningPlayerCharacter;
@@ -159,9 +443,53 @@ private:
 #pragma endregion
 
 public:
+
+#pragma region ClimbProbes
+  // Geometry only climb checks, traced from any frame so they can also run without a live character (e.g. offline validation)
+
+  FClimbProbeFrame GetProbeFrame() const;
+
+  bool SweepClimbableSurfaces(const FClimbProbeFrame& InFrame, TArray<FHitResult>& OutSurfaceHits, FVector& OutTraceOrigin) const;
+  FHitResult TraceFromEyeHeight(const FClimbProbeFrame& InFrame, float TraceDistance, float TraceStartOffset = 0.f, bool bShowDebugShape = false, bool bDrawPersistantShapes = false) const;
+
+  // Same as CanStartClimbing, without storing contacts or using the surface cache
+  bool HasClimbableSurface(const FClimbProbeFrame& InFrame) const;
+  bool CanClimbDownLedge(const FClimbProbeFrame& InFrame) const;
+  bool HasLedgeAbove(const FClimbProbeFrame& InFrame) const;
+  bool CanStartVaulting(const FClimbProbeFrame& InFrame, FVector& OutVaultStartPosition, FVector& OutVaultLandPosition) const;
+  bool CheckCanHopUp(const FClimbProbeFrame& InFrame, FVector& OutHopUpTargetPosition) const;
+  bool CheckCanHopDown(const FClimbProbeFrame& InFrame, FVector& OutHopDownTargetPosition) const;
+#pragma endregion
+
   void ToggleClimbing(bool bEnableClimb);
   void RequestHopping();
+
+  void EnterClimbableRegion(const AClimbableRegionVolume* InRegion);
+  void ExitClimbableRegion(const AClimbableRegionVolume* InRegion);
+
+  // Inside a climbable region, or in a world without any, so climb, ledge and vault probes are worth running
+  bool IsClimbCandidate() const;
+
+  // Marks a climb input issued this frame, for the input to movement and input to pose latency stats
+  void StampClimbInput();
+  FClimbAnimSnapshot GetClimbAnimSnapshot() const;
+
+  // Leaves climbing and clears every bit of climb state, for climbers reused from a pool
+  void ResetClimbState();
+
+  // A transition montage or corner wrap is under way, its follow-up probes are prioritized by the probe budget
+  bool HasPendingClimbTransition() const;
   bool IsClimbing() const;
   FORCEINLINE FVector GetClimbableSurfaceNormal() const { return CurrentClimbableSurfaceNormal; }
+  FORCEINLINE TConstArrayView<FClimbContact> GetClimbContacts() const { return ClimbContacts; }
+  FORCEINLINE FVector GetClimbContactsOrigin() const { return ClimbContactsOrigin; }
+  ECollisionChannel GetClimbableTraceChannel() const;
+  const UClimbProfile& GetClimbProfile() const;
+
+  // Distinct components under the current climb contacts
+  void GetClimbedComponents(TArray<const UPrimitiveComponent*>& OutComponents) const;
   FVector GetUnrotatedClimbVelocity() const;
+
+  // Bytes used by the climb members of this component, including their heap allocations
+  SIZE_T GetClimbMemoryFootprint() const;
 };
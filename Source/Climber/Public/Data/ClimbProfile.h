@@ -0,0 +1,227 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "ClimberCollision.h"
+#include "ClimbProfile.generated.h"
+
+class UAnimMontage;
+class UClimbProfile;
+
+#if WITH_EDITOR
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnClimbProfileChanged, const UClimbProfile*);
+#endif
+
+/**
+ * Climb tuning and transition montages shared by every climber referencing it, read only at runtime.
+ * Climbers without a profile use the class default object.
+ */
+UCLASS(BlueprintType)
+class CLIMBER_API UClimbProfile : public UPrimaryDataAsset
+{
+  GENERATED_BODY()
+
+public:
+#pragma region Traces
+  // Climbable surface sweeps only, geometry has to opt into it
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Traces")
+  TEnumAsByte<ECollisionChannel> ClimbableTraceChannel = ECC_Climbable;
+
+  // Object type the floor, walkable ground, ledge top and vault probes trace, untagged level geometry included
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Traces")
+  TEnumAsByte<ECollisionChannel> WorldTraceObjectType = ECC_WorldStatic;
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Traces")
+  float ClimbCapsuleTraceRadius = 50.f;
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Traces")
+  float ClimbCapsuleTraceHalfHeight = 72.f;
+
+  // Climbable surface sweep start, ahead of the character along its forward vector
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Traces")
+  float SurfaceTraceOffset = 30.f;
+
+  // Floor sweep start, below the character along its up vector
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Traces")
+  float FloorTraceOffset = 50.f;
+
+  // Length of the eye height traces checking for a wall to start climbing, ledges and hop targets
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Traces")
+  float EyeHeightTraceDistance = 100.f;
+#pragma endregion
+
+#pragma region Movement
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement")
+  float ClimbCapsuleHalfHeight = 48.f;
+
+  // Restored when leaving the climb state
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement")
+  float WalkCapsuleHalfHeight = 96.f;
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement")
+  float MaxBrakeClimbDeceleration = 400.f;
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement")
+  float MaxClimbSpeed = 100.f;
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement")
+  float MaxClimbAcceleration = 300.f;
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement")
+  float ClimbRotationInterpSpeed = 5.f;
+
+  // Surfaces closer to the up vector than this are too flat to climb
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement", meta = (ClampMin = "0.0", ClampMax = "90.0"))
+  float StopClimbingAngle = 60.f;
+
+  // Smallest angle between the climbed face and a neighbouring one that counts as a corner
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement")
+  float MinCornerAngle = 30.f;
+
+  // Climb speed down above which a floor ends the climb, and up above which a ledge is looked for
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement", meta = (ClampMin = "0.0"))
+  float FloorReachedSpeed = 10.f;
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement", meta = (ClampMin = "0.0"))
+  float LedgeReachedSpeed = 10.f;
+
+  // Climbers on the same wall are pushed apart while closer than the sum of their radii, 0 to never separate
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement", meta = (ClampMin = "0.0"))
+  float ClimbSeparationRadius = 40.f;
+
+  // Separation speed at which the push takes the whole climb acceleration, it steers like move input
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement", meta = (ClampMin = "0.0"))
+  float MaxClimbSeparationSpeed = 80.f;
+#pragma endregion
+
+#pragma region Ledges
+  // Climbing down a ledge: the walkable surface probe ahead of the character, then the ledge probe past it that must find nothing
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Ledges")
+  float ClimbDownWalkableSurfaceTraceOffset = 100.f;
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Ledges")
+  float ClimbDownWalkableSurfaceTraceLength = 100.f;
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Ledges")
+  float ClimbDownLedgeTraceOffset = 50.f;
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Ledges")
+  float ClimbDownLedgeTraceLength = 200.f;
+
+  // Climbing up to a ledge: height above the eyes that has to be free of walls, and how far below it the ledge top is searched
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Ledges")
+  float LedgeAboveTraceOffset = 50.f;
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Ledges")
+  float LedgeAboveWalkableSurfaceTraceLength = 100.f;
+#pragma endregion
+
+#pragma region Hops
+  // Eye height trace offsets, the hop up target and the ledge that must be free above it, and the hop down target
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Hops")
+  float HopUpTraceOffset = -20.f;
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Hops")
+  float HopUpSafetyLedgeTraceOffset = 150.f;
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Hops")
+  float HopDownTraceOffset = -300.f;
+
+  // Hop candidates are traced again after this many seconds while climbing, 0 to only refresh on distance
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Hops")
+  float HopCandidateRefreshInterval = 0.25f;
+
+  // Hop candidates are traced again once the character moved this far from the last refresh
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Hops")
+  float HopCandidateRefreshDistance = 20.f;
+#pragma endregion
+
+#pragma region Vaulting
+  // Forward spacing of the vault probes, the start probe sits one spacing ahead and the clearance sweep covers three
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Vaulting")
+  float VaultProbeSpacing = 80.f;
+
+  // Height above the feet the vault start probe traces down from
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Vaulting")
+  float VaultProbeHeight = 100.f;
+
+  // How far below the feet the landing probe reaches
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Vaulting")
+  float VaultLandProbeDepth = 300.f;
+
+  // Highest obstacle top above the feet that can be vaulted over
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Vaulting")
+  float MaxVaultObstacleHeight = 200.f;
+
+  // Radius of the sweep checking the space above the obstacle top is free
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Vaulting")
+  float VaultClearanceRadius = 20.f;
+
+  // The landing point has to be this much lower than the obstacle top, otherwise the obstacle is too thick to vault
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Vaulting")
+  float MinVaultDropHeight = 30.f;
+#pragma endregion
+
+#pragma region Streaming
+  // Climb montages are async loaded once climbable geometry is within this distance
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Streaming")
+  float ClimbMontagesPreloadRadius = 600.f;
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Streaming")
+  float ClimbMontagesPreloadCheckInterval = 0.5f;
+
+  // Loaded climb montages are released after being away from climbable geometry for this long
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Streaming")
+  float ClimbMontagesReleaseDelay = 30.f;
+#pragma endregion
+
+#pragma region Networking
+  // Servers throttle replication of climbers hanging still for this long
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Networking")
+  float ClimbNetIdleThreshold = 2.f;
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Networking")
+  float ClimbNetIdleUpdateFrequency = 2.f;
+
+  // Idle climbers without a player go dormant instead, player climbers keep their channel for client corrections
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Networking")
+  bool bAllowClimbNetDormancy = true;
+#pragma endregion
+
+#pragma region Montages
+  // Default to the project montages, so climbers without a profile asset still play their transitions
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Montages", meta = (AssetBundles = "Climbing"))
+  TSoftObjectPtr<UAnimMontage> IdleToClimbMontage = TSoftObjectPtr<UAnimMontage>(FSoftObjectPath(TEXT("/Game/ClimbingSystem/Animation/Montages/AM_IdleToClimb.AM_IdleToClimb")));
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Montages", meta = (AssetBundles = "Climbing"))
+  TSoftObjectPtr<UAnimMontage> ClimbToTopMontage = TSoftObjectPtr<UAnimMontage>(FSoftObjectPath(TEXT("/Game/ClimbingSystem/Animation/Montages/AM_ClimbToTop.AM_ClimbToTop")));
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Montages", meta = (AssetBundles = "Climbing"))
+  TSoftObjectPtr<UAnimMontage> ClimbDownLedgeMontage = TSoftObjectPtr<UAnimMontage>(FSoftObjectPath(TEXT("/Game/ClimbingSystem/Animation/Montages/AM_ClimbDownLedge.AM_ClimbDownLedge")));
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Montages", meta = (AssetBundles = "Climbing"))
+  TSoftObjectPtr<UAnimMontage> VaultMontage = TSoftObjectPtr<UAnimMontage>(FSoftObjectPath(TEXT("/Game/ClimbingSystem/Animation/Montages/AM_Vaulting.AM_Vaulting")));
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Montages", meta = (AssetBundles = "Climbing"))
+  TSoftObjectPtr<UAnimMontage> HopUpMontage = TSoftObjectPtr<UAnimMontage>(FSoftObjectPath(TEXT("/Game/ClimbingSystem/Animation/Montages/AM_HopUp.AM_HopUp")));
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Montages", meta = (AssetBundles = "Climbing"))
+  TSoftObjectPtr<UAnimMontage> HopDownMontage = TSoftObjectPtr<UAnimMontage>(FSoftObjectPath(TEXT("/Game/ClimbingSystem/Animation/Montages/AM_HopDown.AM_HopDown")));
+
+  // Corner wraps warp to CornerWrapPoint, location and rotation
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Montages", meta = (AssetBundles = "Climbing"))
+  TSoftObjectPtr<UAnimMontage> InnerCornerWrapMontage;
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Montages", meta = (AssetBundles = "Climbing"))
+  TSoftObjectPtr<UAnimMontage> OuterCornerWrapMontage;
+#pragma endregion
+
+#if WITH_EDITOR
+  // Broadcast when a profile is edited, climbers in PIE refresh what they derived from it
+  static FOnClimbProfileChanged OnClimbProfileChanged;
+
+  virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+};
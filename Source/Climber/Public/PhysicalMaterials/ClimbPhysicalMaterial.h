@@ -0,0 +1,46 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+#include "Engine/HitResult.h"
+#include "ClimbPhysicalMaterial.generated.h"
+
+USTRUCT(BlueprintType)
+struct FClimbSurfaceProperties
+{
+  GENERATED_BODY()
+
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing")
+  bool bClimbable = true;
+
+  // Scales the brake deceleration while climbing, low grip surfaces keep sliding
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing", meta = (ClampMin = "0.0"))
+  float Grip = 1.f;
+
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing", meta = (ClampMin = "0.0"))
+  float SpeedScale = 1.f;
+
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing", meta = (ClampMin = "0.0"))
+  float AccelerationScale = 1.f;
+};
+
+/**
+ * Physical material carrying climbing properties for the surfaces using it
+ */
+UCLASS()
+class CLIMBER_API UClimbPhysicalMaterial : public UPhysicalMaterial
+{
+  GENERATED_BODY()
+
+public:
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing")
+  FClimbSurfaceProperties ClimbSurface;
+
+  // Physical material under a hit, the one the query returned for the hit face or shape, else the simple one of the hit body
+  static const UPhysicalMaterial* ResolvePhysicalMaterial(const FHitResult& InHit);
+
+  // Climb properties of a physical material, defaults unless it is a UClimbPhysicalMaterial
+  static FClimbSurfaceProperties GetSurfaceProperties(const UPhysicalMaterial* InPhysicalMaterial);
+};
@@ -0,0 +1,85 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ClimbBatchSolver.h"
+#include "ClimbSeparation.h"
+#include "ClimbBatchSubsystem.generated.h"
+
+class UClimbBatchSubsystem;
+class UCustomMovementComponent;
+class UClimbProfile;
+
+// Runs between the climb probe ticks and the movement ticks of every registered climber
+USTRUCT()
+struct FClimbBatchTickFunction : public FTickFunction
+{
+  GENERATED_BODY()
+
+  UClimbBatchSubsystem* Target = nullptr;
+
+  virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+  virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FClimbBatchTickFunction> : public TStructOpsTypeTraitsBase2<FClimbBatchTickFunction>
+{
+  enum
+  {
+    WithCopy = false
+  };
+};
+
+/**
+ * Solves the climb surface of every climber with fresh probe results in one batched pass,
+ * instead of each movement tick reducing its own contacts, and separates climbers sharing a wall
+ */
+UCLASS()
+class CLIMBER_API UClimbBatchSubsystem : public UWorldSubsystem
+{
+  GENERATED_BODY()
+
+public:
+  virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+  virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+  virtual void Deinitialize() override;
+
+  void RegisterClimber(UCustomMovementComponent* InClimber);
+  void UnregisterClimber(UCustomMovementComponent* InClimber);
+
+private:
+  friend struct FClimbBatchTickFunction;
+
+  void SolveClimbers();
+  void SolveBatches();
+  void SeparateClimbers();
+
+  FClimbBatchTickFunction BatchTickFunction;
+
+  UPROPERTY()
+  TArray<TObjectPtr<UCustomMovementComponent>> Climbers;
+
+  // One batch per climb profile, as the stop angle is the same for a whole batch. Reused every frame.
+  struct FProfileBatch
+  {
+    const UClimbProfile* Profile = nullptr;
+    FClimbSolverBatch Batch;
+    FClimbSolverBatchResults Results;
+
+    // Climbers[i] is climber i of the batch
+    TArray<UCustomMovementComponent*> Climbers;
+
+    // Some registered climber uses the profile, climbing or not
+    bool bInUse = false;
+  };
+
+  TArray<FProfileBatch, TInlineAllocator<2>> ProfileBatches;
+
+  // Reused every frame, SeparationClimbers[i] is agent i
+  TArray<FClimbSeparationAgent> SeparationAgents;
+  TArray<FVector> SeparationVelocities;
+  TArray<UCustomMovementComponent*> SeparationClimbers;
+};
@@ -0,0 +1,71 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Templates/Function.h"
+#include "ClimbProbeBudgetSubsystem.generated.h"
+
+class UCustomMovementComponent;
+
+struct FClimbProbeBudgetStats
+{
+  // Current frame
+  int32 FrameQueries = 0;
+  int32 FrameDeferred = 0;
+  double FrameProbeTimeMs = 0.0;
+
+  // Since the world began play
+  uint64 TotalDeferred = 0;
+  uint64 OverrunFrames = 0;
+  int32 MaxFramesWaiting = 0;
+};
+
+/**
+ * Caps the deferrable climb scene queries issued per frame: hop candidate refreshes, IK refinement traces,
+ * montage preload overlaps and AI climb attempts. The per-frame surface and floor probes are never deferred.
+ * Player-controlled climbers always run, the others are granted budget by priority and retry on later frames.
+ */
+UCLASS()
+class CLIMBER_API UClimbProbeBudgetSubsystem : public UWorldSubsystem
+{
+  GENERATED_BODY()
+
+public:
+  virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+  // Runs Probe now when Requester fits in this frame's budget, false when it was deferred and should be retried later
+  bool TryRunProbe(const UCustomMovementComponent* Requester, int32 QueryCost, TFunctionRef<void()> Probe);
+
+  // TryRunProbe through the requester's world, runs the probe directly in worlds without the subsystem
+  static bool RunProbe(const UCustomMovementComponent* Requester, int32 QueryCost, TFunctionRef<void()> Probe);
+
+  FORCEINLINE const FClimbProbeBudgetStats& GetStats() const { return Stats; }
+
+private:
+  struct FRequesterState
+  {
+    // Queries reserved for this frame by priority
+    int32 Granted = 0;
+
+    // Queries denied this frame, reserved for next frame
+    int32 Demand = 0;
+
+    int32 FramesWaiting = 0;
+    uint64 LastRequestFrame = 0;
+  };
+
+  void BeginBudgetFrame();
+  float GetPriority(const UCustomMovementComponent* InRequester, const FRequesterState& InState) const;
+
+  TMap<TWeakObjectPtr<const UCustomMovementComponent>, FRequesterState> Requesters;
+
+  // Player pawn locations this frame, climbers far from all of them come last
+  TArray<FVector, TInlineAllocator<4>> ViewerLocations;
+
+  uint64 BudgetFrame = 0;
+  int32 UnreservedQueries = 0;
+
+  FClimbProbeBudgetStats Stats;
+};
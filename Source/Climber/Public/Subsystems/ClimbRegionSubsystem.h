@@ -0,0 +1,32 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ClimbRegionSubsystem.generated.h"
+
+class AClimbableRegionVolume;
+
+/**
+ * Tracks the climbable regions in play. Overlaps with the regions are found by the physics broadphase,
+ * this only tells climbers whether the world uses regions at all.
+ */
+UCLASS()
+class CLIMBER_API UClimbRegionSubsystem : public UWorldSubsystem
+{
+  GENERATED_BODY()
+
+public:
+  virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+  void RegisterRegion(AClimbableRegionVolume* InRegion);
+  void UnregisterRegion(AClimbableRegionVolume* InRegion);
+
+  // False when climbing is allowed anywhere, e.g. levels authored before regions existed
+  FORCEINLINE bool HasRegions() const { return !Regions.IsEmpty(); }
+
+private:
+  UPROPERTY()
+  TArray<TObjectPtr<AClimbableRegionVolume>> Regions;
+};
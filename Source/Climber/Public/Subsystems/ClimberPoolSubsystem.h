@@ -0,0 +1,69 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ClimberPoolSubsystem.generated.h"
+
+class AClimberCharacter;
+class AController;
+
+USTRUCT()
+struct FPooledClimber
+{
+  GENERATED_BODY()
+
+  UPROPERTY()
+  TObjectPtr<AClimberCharacter> Climber;
+
+  // AI controller that possessed the climber before it was pooled, possesses it again on reuse
+  UPROPERTY()
+  TObjectPtr<AController> Controller;
+};
+
+USTRUCT()
+struct FClimberPool
+{
+  GENERATED_BODY()
+
+  UPROPERTY()
+  TArray<FPooledClimber> Inactive;
+};
+
+/**
+ * Keeps hidden, inactive climbers around so waves reuse them instead of spawning.
+ * Reused climbers skip construction and BeginPlay, their climb state is reset when they are released.
+ */
+UCLASS()
+class CLIMBER_API UClimberPoolSubsystem : public UWorldSubsystem
+{
+  GENERATED_BODY()
+
+public:
+  virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+  virtual void Deinitialize() override;
+
+  // Spawns climbers into the pool up front, e.g. during a loading screen or between waves
+  UFUNCTION(BlueprintCallable, Category = "Climber Pool")
+  void Prewarm(TSubclassOf<AClimberCharacter> ClimberClass, int32 Count);
+
+  // Places a pooled climber of ClimberClass at InTransform, spawning one only when the pool is empty
+  UFUNCTION(BlueprintCallable, Category = "Climber Pool")
+  AClimberCharacter* AcquireClimber(TSubclassOf<AClimberCharacter> ClimberClass, const FTransform& InTransform);
+
+  // Resets and hides the climber, player controllers are unpossessed
+  UFUNCTION(BlueprintCallable, Category = "Climber Pool")
+  void ReleaseClimber(AClimberCharacter* Climber);
+
+  UFUNCTION(BlueprintPure, Category = "Climber Pool")
+  int32 GetNumPooled(TSubclassOf<AClimberCharacter> ClimberClass) const;
+
+private:
+  AClimberCharacter* SpawnClimber(TSubclassOf<AClimberCharacter> ClimberClass, const FTransform& InTransform) const;
+  void DeactivateClimber(AClimberCharacter* Climber, FPooledClimber& OutPooled) const;
+  void ActivateClimber(const FPooledClimber& Pooled, const FTransform& InTransform) const;
+
+  UPROPERTY()
+  TMap<TSubclassOf<AClimberCharacter>, FClimberPool> Pools;
+};
@@ -0,0 +1,26 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Volume.h"
+#include "ClimbableRegionVolume.generated.h"
+
+/**
+ * Marks where climbable geometry is. Once a level has any of these, climb, ledge and vault probes only run
+ * for characters overlapping one, levels without them keep probing everywhere.
+ */
+UCLASS()
+class CLIMBER_API AClimbableRegionVolume : public AVolume
+{
+  GENERATED_BODY()
+
+public:
+  AClimbableRegionVolume(const FObjectInitializer& ObjectInitializer);
+
+protected:
+  virtual void BeginPlay() override;
+  virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+  virtual void NotifyActorBeginOverlap(AActor* OtherActor) override;
+  virtual void NotifyActorEndOverlap(AActor* OtherActor) override;
+};
@@ -0,0 +1,14 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class ClimberCore : ModuleRules
+{
+	public ClimberCore(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		// Plain math over plain structs, keep this module free of UObject and Engine dependencies
+		PublicDependencyModuleNames.AddRange(new string[] { "Core" });
+	}
+}
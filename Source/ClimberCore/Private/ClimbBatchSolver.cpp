@@ -0,0 +1,168 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbBatchSolver.h"
+#include "ClimbSolver.h"
+#include "HAL/IConsoleManager.h"
+
+#if INTEL_ISPC
+#include "ClimbBatchSolver.ispc.generated.h"
+#endif
+
+#if !INTEL_ISPC
+static constexpr bool bClimbSolver_ISPC_Enabled = false;
+#elif UE_BUILD_SHIPPING
+static constexpr bool bClimbSolver_ISPC_Enabled = true;
+#else
+static bool bClimbSolver_ISPC_Enabled = true;
+static FAutoConsoleVariableRef CVarClimbSolverISPCEnabled(
+  TEXT("ClimberCore.ISPC"),
+  bClimbSolver_ISPC_Enabled,
+  TEXT("Solves climber batches with the ISPC kernel instead of the scalar path.")
+);
+#endif
+
+FClimbSolverBatch::FClimbSolverBatch()
+{
+  Reset();
+}
+
+void FClimbSolverBatch::Reset()
+{
+  PointX.Reset();
+  PointY.Reset();
+  PointZ.Reset();
+  NormalX.Reset();
+  NormalY.Reset();
+  NormalZ.Reset();
+  FloorNormalZ.Reset();
+  ClimbVelocityZ.Reset();
+  Origins.Reset();
+
+  ContactOffsets.Reset();
+  ContactOffsets.Add(0);
+  FloorOffsets.Reset();
+  FloorOffsets.Add(0);
+}
+
+int32 FClimbSolverBatch::AddClimber(TConstArrayView<FClimbContact> InContacts, const FVector& InOrigin, TConstArrayView<float> InFloorNormalZ, float InClimbVelocityZ)
+{
+  for (const FClimbContact& Contact : InContacts)
+  {
+    // Relative to the origin, the same as the quantized contact point
+    const FVector LocalPoint = Contact.GetPoint(FVector::ZeroVector);
+    const FVector Normal = Contact.GetNormal();
+
+    PointX.Add(LocalPoint.X);
+    PointY.Add(LocalPoint.Y);
+    PointZ.Add(LocalPoint.Z);
+    NormalX.Add(Normal.X);
+    NormalY.Add(Normal.Y);
+    NormalZ.Add(Normal.Z);
+  }
+  ContactOffsets.Add(PointX.Num());
+
+  FloorNormalZ.Append(InFloorNormalZ.GetData(), InFloorNormalZ.Num());
+  FloorOffsets.Add(FloorNormalZ.Num());
+
+  ClimbVelocityZ.Add(InClimbVelocityZ);
+  return Origins.Add(InOrigin);
+}
+
+void FClimbSolverBatchResults::SetNum(int32 InNum)
+{
+  for (TArray<float>* Channel : { &LocationX, &LocationY, &LocationZ, &NormalX, &NormalY, &NormalZ, &RotationX, &RotationY, &RotationZ, &RotationW })
+  {
+    Channel->SetNumUninitialized(InNum, false);
+  }
+  Flags.SetNumUninitialized(InNum, false);
+}
+
+void ClimbSolver::SolveBatch(const FClimbSolverBatch& InBatch, float StopAngleDegrees, float FloorReachedSpeed, FClimbSolverBatchResults& OutResults)
+{
+  if (!bClimbSolver_ISPC_Enabled)
+  {
+    SolveBatchScalar(InBatch, StopAngleDegrees, FloorReachedSpeed, OutResults);
+    return;
+  }
+
+#if INTEL_ISPC
+  OutResults.SetNum(InBatch.Num());
+
+  ispc::SolveClimbBatch(
+    InBatch.PointX.GetData(), InBatch.PointY.GetData(), InBatch.PointZ.GetData(),
+    InBatch.NormalX.GetData(), InBatch.NormalY.GetData(), InBatch.NormalZ.GetData(),
+    InBatch.ContactOffsets.GetData(),
+    InBatch.FloorNormalZ.GetData(), InBatch.FloorOffsets.GetData(),
+    InBatch.ClimbVelocityZ.GetData(),
+    InBatch.Num(),
+    FMath::Cos(FMath::DegreesToRadians(StopAngleDegrees)),
+    UE_THRESH_NORMALS_ARE_PARALLEL,
+    FloorReachedSpeed,
+    OutResults.LocationX.GetData(), OutResults.LocationY.GetData(), OutResults.LocationZ.GetData(),
+    OutResults.NormalX.GetData(), OutResults.NormalY.GetData(), OutResults.NormalZ.GetData(),
+    OutResults.RotationX.GetData(), OutResults.RotationY.GetData(), OutResults.RotationZ.GetData(), OutResults.RotationW.GetData(),
+    OutResults.Flags.GetData()
+  );
+#endif
+}
+
+void ClimbSolver::SolveBatchScalar(const FClimbSolverBatch& InBatch, float StopAngleDegrees, float FloorReachedSpeed, FClimbSolverBatchResults& OutResults)
+{
+  OutResults.SetNum(InBatch.Num());
+
+  const float StopCos = FMath::Cos(FMath::DegreesToRadians(StopAngleDegrees));
+
+  for (int32 Climber = 0; Climber < InBatch.Num(); Climber++)
+  {
+    const int32 FirstContact = InBatch.ContactOffsets[Climber];
+    const int32 NumContacts = InBatch.ContactOffsets[Climber + 1] - FirstContact;
+
+    FVector3f Location = FVector3f::ZeroVector;
+    FVector3f Normal = FVector3f::ZeroVector;
+
+    for (int32 Contact = FirstContact; Contact < FirstContact + NumContacts; Contact++)
+    {
+      Location += FVector3f(InBatch.PointX[Contact], InBatch.PointY[Contact], InBatch.PointZ[Contact]);
+      Normal += FVector3f(InBatch.NormalX[Contact], InBatch.NormalY[Contact], InBatch.NormalZ[Contact]);
+    }
+
+    if (NumContacts > 0)
+    {
+      Location /= NumContacts;
+    }
+    Normal = Normal.GetSafeNormal();
+
+    uint8 Flags = 0;
+    if (NumContacts == 0 || Normal.Z >= StopCos)
+    {
+      Flags |= FClimbSolverBatchResults::ShouldStop;
+    }
+
+    if (InBatch.ClimbVelocityZ[Climber] < -FloorReachedSpeed)
+    {
+      for (int32 Floor = InBatch.FloorOffsets[Climber]; Floor < InBatch.FloorOffsets[Climber + 1]; Floor++)
+      {
+        if (FMath::Abs(InBatch.FloorNormalZ[Floor]) >= UE_THRESH_NORMALS_ARE_PARALLEL)
+        {
+          Flags |= FClimbSolverBatchResults::FloorReached;
+          break;
+        }
+      }
+    }
+
+    const FQuat Rotation = Normal.IsZero() ? FQuat::Identity : GetTargetRotation(FVector(Normal));
+
+    OutResults.LocationX[Climber] = Location.X;
+    OutResults.LocationY[Climber] = Location.Y;
+    OutResults.LocationZ[Climber] = Location.Z;
+    OutResults.NormalX[Climber] = Normal.X;
+    OutResults.NormalY[Climber] = Normal.Y;
+    OutResults.NormalZ[Climber] = Normal.Z;
+    OutResults.RotationX[Climber] = Rotation.X;
+    OutResults.RotationY[Climber] = Rotation.Y;
+    OutResults.RotationZ[Climber] = Rotation.Z;
+    OutResults.RotationW[Climber] = Rotation.W;
+    OutResults.Flags[Climber] = Flags;
+  }
+}
@@ -0,0 +1,87 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbSeparation.h"
+
+namespace ClimbSeparation
+{
+  struct FWallCell
+  {
+    uint32 WallKey;
+    FIntVector Cell;
+
+    bool operator==(const FWallCell& Other) const { return WallKey == Other.WallKey && Cell == Other.Cell; }
+    friend uint32 GetTypeHash(const FWallCell& InWallCell) { return HashCombineFast(InWallCell.WallKey, GetTypeHash(InWallCell.Cell)); }
+  };
+}
+
+void ClimbSeparation::ComputeSeparation(TConstArrayView<FClimbSeparationAgent> Agents, TArrayView<FVector> OutVelocities)
+{
+  check(Agents.Num() == OutVelocities.Num());
+
+  float MaxRadius = 0.f;
+  for (int32 AgentIndex = 0; AgentIndex < Agents.Num(); AgentIndex++)
+  {
+    OutVelocities[AgentIndex] = FVector::ZeroVector;
+    MaxRadius = FMath::Max(MaxRadius, Agents[AgentIndex].Radius);
+  }
+
+  if (Agents.Num() < 2 || MaxRadius <= 0.f) return;
+
+  // Cells as large as the widest interaction, so neighbours are always in the 27 cells around an agent
+  const double CellSize = MaxRadius * 2.0;
+
+  TArray<FIntVector, TInlineAllocator<64>> AgentCells;
+  TMultiMap<FWallCell, int32> CellAgents;
+  CellAgents.Reserve(Agents.Num());
+
+  for (int32 AgentIndex = 0; AgentIndex < Agents.Num(); AgentIndex++)
+  {
+    const FVector& Location = Agents[AgentIndex].Location;
+    const FIntVector Cell(
+      FMath::FloorToInt32(Location.X / CellSize),
+      FMath::FloorToInt32(Location.Y / CellSize),
+      FMath::FloorToInt32(Location.Z / CellSize)
+    );
+
+    AgentCells.Add(Cell);
+    CellAgents.Add(FWallCell{ Agents[AgentIndex].WallKey, Cell }, AgentIndex);
+  }
+
+  TArray<int32, TInlineAllocator<16>> Neighbours;
+
+  for (int32 AgentIndex = 0; AgentIndex < Agents.Num(); AgentIndex++)
+  {
+    const FClimbSeparationAgent& Agent = Agents[AgentIndex];
+    FVector Push = FVector::ZeroVector;
+
+    for (int32 OffsetX = -1; OffsetX <= 1; OffsetX++)
+    for (int32 OffsetY = -1; OffsetY <= 1; OffsetY++)
+    for (int32 OffsetZ = -1; OffsetZ <= 1; OffsetZ++)
+    {
+      Neighbours.Reset();
+      CellAgents.MultiFind(FWallCell{ Agent.WallKey, AgentCells[AgentIndex] + FIntVector(OffsetX, OffsetY, OffsetZ) }, Neighbours);
+
+      for (const int32 NeighbourIndex : Neighbours)
+      {
+        const FClimbSeparationAgent& Neighbour = Agents[NeighbourIndex];
+
+        if (NeighbourIndex == AgentIndex) continue;
+
+        const float SeparationDistance = Agent.Radius + Neighbour.Radius;
+        const FVector Away = FVector::VectorPlaneProject(Agent.Location - Neighbour.Location, Agent.SurfaceNormal);
+        const float Distance = Away.Size();
+        if (Distance >= SeparationDistance) continue;
+
+        // Exactly on top of each other, split them sideways by index so both do not pick the same side
+        const FVector Direction = Distance > UE_KINDA_SMALL_NUMBER
+          ? Away / Distance
+          : FVector::CrossProduct(Agent.SurfaceNormal, FVector::UpVector).GetSafeNormal() * (AgentIndex < NeighbourIndex ? -1.f : 1.f);
+
+        Push += Direction * (1.f - Distance / SeparationDistance);
+      }
+    }
+
+    OutVelocities[AgentIndex] = Push.GetClampedToMaxSize(1.f) * Agent.MaxSpeed;
+  }
+}
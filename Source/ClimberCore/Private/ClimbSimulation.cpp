@@ -0,0 +1,76 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbSimulation.h"
+
+FClimbSimState ClimbSimulation::Step(const FClimbSimState& InState, const FClimbSimInput& InInput, const FClimbSimParams& InParams, float StepDeltaTime)
+{
+  FClimbSimState OutState = InState;
+
+  const bool bZeroAcceleration = InInput.Acceleration.IsZero();
+  const bool bVelocityOverMax = InState.Velocity.SizeSquared() > FMath::Square(InParams.MaxSpeed);
+
+  // Brake when coasting or over the max speed, never past a stop
+  if ((bZeroAcceleration || bVelocityOverMax) && !OutState.Velocity.IsZero())
+  {
+    const FVector OldVelocity = OutState.Velocity;
+    OutState.Velocity -= OldVelocity.GetSafeNormal() * InParams.BrakingDeceleration * StepDeltaTime;
+
+    if ((OutState.Velocity | OldVelocity) <= 0.f)
+    {
+      OutState.Velocity = FVector::ZeroVector;
+    }
+    else if (bVelocityOverMax && !bZeroAcceleration && OutState.Velocity.SizeSquared() < FMath::Square(InParams.MaxSpeed))
+    {
+      OutState.Velocity = OldVelocity.GetSafeNormal() * InParams.MaxSpeed;
+    }
+  }
+
+  OutState.Velocity += InInput.Acceleration * StepDeltaTime;
+  OutState.Velocity = OutState.Velocity.GetClampedToMaxSize(FMath::Max(InParams.MaxSpeed, bVelocityOverMax ? InState.Velocity.Size() : 0.f));
+
+  OutState.Location += OutState.Velocity * StepDeltaTime;
+
+  if (!InInput.Surface.Normal.IsNearlyZero())
+  {
+    OutState.Rotation = ClimbSolver::InterpClimbRotation(InState.Rotation, InInput.Surface.Normal, StepDeltaTime, InParams.RotationInterpSpeed);
+  }
+
+  return OutState;
+}
+
+FClimbSimState ClimbSimulation::StepFrame(FClimbFixedStepper& InOutStepper, const FClimbSimState& InState, const FClimbSimInput& InInput, const FClimbSimParams& InParams, float DeltaTime, float StepDeltaTime, float& OutSteppedTime)
+{
+  // Back to the last whole step, the partial step of the previous frame was only presented
+  FClimbSimState State = InState;
+  State.Location -= InOutStepper.PartialStepOffset;
+  if (InOutStepper.bHasPartialStep)
+  {
+    State.Rotation = InOutStepper.WholeStepRotation;
+    State.Velocity = InOutStepper.WholeStepVelocity;
+  }
+
+  const float PreviousPartialTime = InOutStepper.bHasPartialStep ? InOutStepper.Accumulator : 0.f;
+
+  const int32 NumSteps = InOutStepper.Advance(DeltaTime, StepDeltaTime);
+  for (int32 StepIndex = 0; StepIndex < NumSteps; StepIndex++)
+  {
+    State = Step(State, InInput, InParams, StepDeltaTime);
+  }
+
+  InOutStepper.WholeStepRotation = State.Rotation;
+  InOutStepper.WholeStepVelocity = State.Velocity;
+  InOutStepper.bHasPartialStep = InOutStepper.Accumulator > 0.f;
+  OutSteppedTime = NumSteps * StepDeltaTime + InOutStepper.Accumulator - PreviousPartialTime;
+
+  if (!InOutStepper.bHasPartialStep)
+  {
+    InOutStepper.PartialStepOffset = FVector::ZeroVector;
+    return State;
+  }
+
+  const FClimbSimState PresentedState = Step(State, InInput, InParams, InOutStepper.Accumulator);
+  InOutStepper.PartialStepOffset = PresentedState.Location - State.Location;
+
+  return PresentedState;
+}
@@ -0,0 +1,120 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbSolver.h"
+
+FClimbSurface ClimbSolver::ReduceContacts(TConstArrayView<FClimbContact> Contacts, const FVector& Origin)
+{
+  FClimbSurface Surface;
+
+  if (Contacts.IsEmpty()) return Surface;
+
+  for (const FClimbContact& Contact : Contacts)
+  {
+    Surface.Location += Contact.GetPoint(Origin);
+    Surface.Normal += Contact.GetNormal();
+  }
+  Surface.Location /= Contacts.Num();
+  Surface.Normal = Surface.Normal.GetSafeNormal();
+
+  return Surface;
+}
+
+bool ClimbSolver::ShouldStopClimbing(const FVector& SurfaceNormal, float StopAngleDegrees)
+{
+  // Same as comparing the angle to the up vector, without the Acos
+  const float DotResult = FVector::DotProduct(SurfaceNormal, FVector::UpVector);
+  return DotResult >= FMath::Cos(FMath::DegreesToRadians(StopAngleDegrees));
+}
+
+FQuat ClimbSolver::GetTargetRotation(const FVector& SurfaceNormal)
+{
+  return FRotationMatrix::MakeFromX(-SurfaceNormal).ToQuat();
+}
+
+FQuat ClimbSolver::InterpClimbRotation(const FQuat& CurrentRotation, const FVector& SurfaceNormal, float DeltaTime, float InterpSpeed)
+{
+  return FMath::QInterpTo(CurrentRotation, GetTargetRotation(SurfaceNormal), DeltaTime, InterpSpeed);
+}
+
+FVector ClimbSolver::GetSnapVector(const FVector& SurfaceLocation, const FVector& SurfaceNormal, const FVector& Location, const FVector& Forward)
+{
+  const FVector ProjectedCharacterToSurface = (SurfaceLocation - Location).ProjectOnTo(Forward);
+  return -SurfaceNormal * ProjectedCharacterToSurface.Length();
+}
+
+FClimbCorner ClimbSolver::DetectCorner(TConstArrayView<FClimbContact> Contacts, const FVector& Origin, const FVector& CurrentNormal, const FVector& MoveDirection, float MinCornerAngleDegrees, float StopAngleDegrees)
+{
+  FClimbCorner Corner;
+
+  if (Contacts.Num() < 2 || MoveDirection.IsNearlyZero()) return Corner;
+
+  // Contacts within half the corner angle belong to the current face, past the full angle to the next one
+  const float CornerCos = FMath::Cos(FMath::DegreesToRadians(MinCornerAngleDegrees));
+  const float FaceCos = FMath::Cos(FMath::DegreesToRadians(MinCornerAngleDegrees * 0.5f));
+
+  FVector FaceLocation = FVector::ZeroVector;
+  FVector FaceNormal = FVector::ZeroVector;
+  int32 NumFaceContacts = 0;
+
+  FVector NextLocation = FVector::ZeroVector;
+  FVector NextNormal = FVector::ZeroVector;
+  int32 NumNextContacts = 0;
+
+  for (const FClimbContact& Contact : Contacts)
+  {
+    const FVector ContactNormal = Contact.GetNormal();
+    const float Alignment = FVector::DotProduct(ContactNormal, CurrentNormal);
+
+    if (Alignment >= FaceCos)
+    {
+      FaceLocation += Contact.GetPoint(Origin);
+      FaceNormal += ContactNormal;
+      NumFaceContacts++;
+    }
+    else if (Alignment <= CornerCos)
+    {
+      NextLocation += Contact.GetPoint(Origin);
+      NextNormal += ContactNormal;
+      NumNextContacts++;
+    }
+  }
+
+  if (NumFaceContacts == 0 || NumNextContacts == 0) return Corner;
+
+  FaceLocation /= NumFaceContacts;
+  FaceNormal = FaceNormal.GetSafeNormal();
+  NextLocation /= NumNextContacts;
+  NextNormal = NextNormal.GetSafeNormal();
+
+  // Floors and ceilings are not corners
+  if (ShouldStopClimbing(NextNormal, StopAngleDegrees) || ShouldStopClimbing(-NextNormal, StopAngleDegrees)) return Corner;
+
+  const FVector FaceToNext = NextLocation - FaceLocation;
+  if (FVector::DotProduct(FaceToNext, MoveDirection) <= 0.f) return Corner;
+
+  // Points and normals of two faces spread apart on a convex edge and towards each other in a concave one
+  const bool bConvex = FVector::DotProduct(FaceLocation - NextLocation, FaceNormal - NextNormal) > 0.f;
+
+  Corner.Type = bConvex ? EClimbCornerType::Outer : EClimbCornerType::Inner;
+  Corner.Location = NextLocation;
+  Corner.Normal = NextNormal;
+
+  return Corner;
+}
+
+EClimbHopDirection ClimbSolver::ClassifyHopDirection(const FVector& LocalInput, float DirectionThreshold)
+{
+  const float DotResult = FVector::DotProduct(LocalInput.GetSafeNormal(), FVector::UpVector);
+
+  if (DotResult >= DirectionThreshold)
+  {
+    return EClimbHopDirection::Up;
+  }
+  else if (DotResult <= -DirectionThreshold)
+  {
+    return EClimbHopDirection::Down;
+  }
+
+  return EClimbHopDirection::None;
+}
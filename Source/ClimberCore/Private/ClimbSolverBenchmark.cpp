@@ -0,0 +1,127 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbSolver.h"
+#include "ClimbBatchSolver.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogClimbSolverBenchmark, Log, All);
+
+namespace ClimbSolverBenchmark
+{
+  // Runs Body Iterations times and logs the average cost of one call
+  template <typename FuncType>
+  void Run(const TCHAR* Name, int32 Iterations, FuncType&& Body)
+  {
+    const double StartTime = FPlatformTime::Seconds();
+    for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+    {
+      Body(Iteration);
+    }
+    const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+
+    UE_LOG(LogClimbSolverBenchmark, Log, TEXT("%-24s %8.1f ns/call"), Name, ElapsedSeconds * 1e9 / Iterations);
+  }
+}
+
+static FAutoConsoleCommand ClimbSolverBenchmarkCommand(
+  TEXT("ClimberCore.Bench"),
+  TEXT("Times the climb solver functions over random contacts, and per climber calls against batched solves at 1, 100 and 1000 climbers. Usage: ClimberCore.Bench [Iterations]"),
+  FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+  {
+    const int32 Iterations = Args.IsEmpty() ? 100000 : FMath::Max(1, FCString::Atoi(*Args[0]));
+
+    // A fixed pool of inputs, cycled by the iteration index
+    constexpr int32 NumSamples = 256;
+    FRandomStream RandomStream(1234);
+
+    TArray<FClimbContact> Contacts;
+    TArray<FVector> Normals;
+    for (int32 SampleIndex = 0; SampleIndex < NumSamples; SampleIndex++)
+    {
+      const FVector Normal = RandomStream.GetUnitVector();
+      Contacts.Emplace(RandomStream.GetUnitVector() * 50.f, Normal, FVector::ZeroVector, 0);
+      Normals.Add(Normal);
+    }
+
+    // Keeps results alive so the calls are not optimized away
+    FVector Sink = FVector::ZeroVector;
+
+    ClimbSolverBenchmark::Run(TEXT("ReduceContacts(8)"), Iterations, [&](int32 Iteration)
+    {
+      const int32 First = Iteration % (NumSamples - 8);
+      Sink += ClimbSolver::ReduceContacts(TConstArrayView<FClimbContact>(Contacts.GetData() + First, 8), FVector::ZeroVector).Normal;
+    });
+
+    ClimbSolverBenchmark::Run(TEXT("ShouldStopClimbing"), Iterations, [&](int32 Iteration)
+    {
+      Sink.X += ClimbSolver::ShouldStopClimbing(Normals[Iteration % NumSamples], 60.f);
+    });
+
+    ClimbSolverBenchmark::Run(TEXT("InterpClimbRotation"), Iterations, [&](int32 Iteration)
+    {
+      Sink += ClimbSolver::InterpClimbRotation(FQuat::Identity, Normals[Iteration % NumSamples], 1.f / 60.f, 5.f).GetForwardVector();
+    });
+
+    ClimbSolverBenchmark::Run(TEXT("GetSnapVector"), Iterations, [&](int32 Iteration)
+    {
+      const FVector& Normal = Normals[Iteration % NumSamples];
+      Sink += ClimbSolver::GetSnapVector(Normal * 40.f, Normal, FVector::ZeroVector, -Normal);
+    });
+
+    ClimbSolverBenchmark::Run(TEXT("ClassifyHopDirection"), Iterations, [&](int32 Iteration)
+    {
+      Sink.Y += (float)ClimbSolver::ClassifyHopDirection(Normals[Iteration % NumSamples]);
+    });
+
+    // A frame of climbers, 8 contacts and 2 floor hits each, per climber calls against one batched pass
+    for (const int32 NumClimbers : { 1, 100, 1000 })
+    {
+      constexpr int32 ContactsPerClimber = 8;
+      const float FloorNormalZ[] = { 1.f, 0.3f };
+
+      FClimbSolverBatch Batch;
+      for (int32 Climber = 0; Climber < NumClimbers; Climber++)
+      {
+        const int32 First = Climber % (NumSamples - ContactsPerClimber);
+        Batch.AddClimber(TConstArrayView<FClimbContact>(Contacts.GetData() + First, ContactsPerClimber), FVector::ZeroVector, FloorNormalZ, -20.f);
+      }
+
+      // Keeps the total work close to the single call benchmarks above
+      const int32 BatchIterations = FMath::Max(1, Iterations / NumClimbers);
+      FClimbSolverBatchResults Results;
+
+      ClimbSolverBenchmark::Run(*FString::Printf(TEXT("PerClimber(%d)"), NumClimbers), BatchIterations, [&](int32 Iteration)
+      {
+        for (int32 Climber = 0; Climber < NumClimbers; Climber++)
+        {
+          const int32 First = Climber % (NumSamples - ContactsPerClimber);
+          const FClimbSurface Surface = ClimbSolver::ReduceContacts(TConstArrayView<FClimbContact>(Contacts.GetData() + First, ContactsPerClimber), FVector::ZeroVector);
+          Sink.X += ClimbSolver::ShouldStopClimbing(Surface.Normal, 60.f);
+
+          for (const float FloorZ : FloorNormalZ)
+          {
+            Sink.Y += FVector::Parallel(FVector(0.f, 0.f, -FloorZ), FVector::UpVector);
+          }
+
+          Sink += ClimbSolver::GetTargetRotation(Surface.Normal).GetForwardVector();
+        }
+      });
+
+      ClimbSolverBenchmark::Run(*FString::Printf(TEXT("BatchScalar(%d)"), NumClimbers), BatchIterations, [&](int32 Iteration)
+      {
+        ClimbSolver::SolveBatchScalar(Batch, 60.f, 10.f, Results);
+        Sink.Z += Results.RotationW[Iteration % NumClimbers];
+      });
+
+      ClimbSolverBenchmark::Run(*FString::Printf(TEXT("Batch(%d)"), NumClimbers), BatchIterations, [&](int32 Iteration)
+      {
+        ClimbSolver::SolveBatch(Batch, 60.f, 10.f, Results);
+        Sink.Z += Results.RotationW[Iteration % NumClimbers];
+      });
+    }
+
+    UE_LOG(LogClimbSolverBenchmark, Verbose, TEXT("Sink %s"), *Sink.ToString());
+  })
+);
@@ -0,0 +1,428 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbSolver.h"
+#include "ClimbBatchSolver.h"
+#include "ClimbSeparation.h"
+#include "ClimbSimulation.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Plain math, runs in any context including commandlets on CI: -ExecCmds="Automation RunTests Climber.Core"
+static constexpr EAutomationTestFlags::Type ClimberCoreTestFlags = EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter;
+
+#pragma region ClimbSolver
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClimbSolverReduceContactsTest, "Climber.Core.ClimbSolver.ReduceContacts", ClimberCoreTestFlags)
+
+bool FClimbSolverReduceContactsTest::RunTest(const FString& Parameters)
+{
+  const FVector Origin(1000.f, -500.f, 200.f);
+
+  const FClimbSurface EmptySurface = ClimbSolver::ReduceContacts(TConstArrayView<FClimbContact>(), Origin);
+  TestTrue(TEXT("No contacts give a zero surface"), EmptySurface.Normal.IsZero() && EmptySurface.Location.IsZero());
+
+  // Two contacts on a wall facing -X, with normals tilted symmetrically up and down
+  const FClimbContact Contacts[] = {
+    FClimbContact(Origin + FVector(50.f, 0.f, 20.f), FVector(-1.f, 0.f, 0.5f), Origin, 0),
+    FClimbContact(Origin + FVector(50.f, 10.f, -20.f), FVector(-1.f, 0.f, -0.5f), Origin, 0)
+  };
+
+  const FClimbSurface Surface = ClimbSolver::ReduceContacts(Contacts, Origin);
+  TestTrue(TEXT("Location is the average contact point"), Surface.Location.Equals(Origin + FVector(50.f, 5.f, 0.f), 0.25f));
+  TestTrue(TEXT("Normal is the normalized average contact normal"), Surface.Normal.Equals(FVector(-1.f, 0.f, 0.f), 1e-3f));
+
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClimbSolverShouldStopClimbingTest, "Climber.Core.ClimbSolver.ShouldStopClimbing", ClimberCoreTestFlags)
+
+bool FClimbSolverShouldStopClimbingTest::RunTest(const FString& Parameters)
+{
+  TestFalse(TEXT("Vertical wall is climbable"), ClimbSolver::ShouldStopClimbing(FVector(-1.f, 0.f, 0.f), 60.f));
+  TestTrue(TEXT("Floor stops climbing"), ClimbSolver::ShouldStopClimbing(FVector::UpVector, 60.f));
+  TestFalse(TEXT("Ceiling does not count as a floor"), ClimbSolver::ShouldStopClimbing(FVector::DownVector, 60.f));
+
+  // 50 and 70 degrees away from up, either side of the 60 degree stop angle
+  const FVector SteepNormal = FVector(FMath::Sin(FMath::DegreesToRadians(70.f)), 0.f, FMath::Cos(FMath::DegreesToRadians(70.f)));
+  const FVector FlatNormal = FVector(FMath::Sin(FMath::DegreesToRadians(50.f)), 0.f, FMath::Cos(FMath::DegreesToRadians(50.f)));
+  TestFalse(TEXT("Slope steeper than the stop angle is climbable"), ClimbSolver::ShouldStopClimbing(SteepNormal, 60.f));
+  TestTrue(TEXT("Slope flatter than the stop angle stops climbing"), ClimbSolver::ShouldStopClimbing(FlatNormal, 60.f));
+
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClimbSolverGetTargetRotationTest, "Climber.Core.ClimbSolver.GetTargetRotation", ClimberCoreTestFlags)
+
+bool FClimbSolverGetTargetRotationTest::RunTest(const FString& Parameters)
+{
+  const FVector WallNormals[] = { FVector(-1.f, 0.f, 0.f), FVector(0.f, 1.f, 0.f), FVector(0.6f, -0.8f, 0.f), FVector(-0.8f, 0.f, 0.6f) };
+
+  for (const FVector& WallNormal : WallNormals)
+  {
+    const FQuat TargetRotation = ClimbSolver::GetTargetRotation(WallNormal);
+    TestTrue(FString::Printf(TEXT("Faces into the wall %s"), *WallNormal.ToString()), TargetRotation.GetForwardVector().Equals(-WallNormal, 1e-4f));
+    TestTrue(FString::Printf(TEXT("Is normalized for %s"), *WallNormal.ToString()), TargetRotation.IsNormalized());
+  }
+
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClimbSolverDetectCornerTest, "Climber.Core.ClimbSolver.DetectCorner", ClimberCoreTestFlags)
+
+bool FClimbSolverDetectCornerTest::RunTest(const FString& Parameters)
+{
+  const FVector Origin(1000.f, -500.f, 200.f);
+  const FVector CurrentNormal(-1.f, 0.f, 0.f);
+  const FVector Right(0.f, 1.f, 0.f);
+
+  // Climbing a wall facing -X, two contacts on it and two on the next face
+  auto MakeContacts = [&Origin, &CurrentNormal](const FVector& NextPoint, const FVector& NextNormal)
+  {
+    return TArray<FClimbContact>{
+      FClimbContact(Origin + FVector(50.f, 0.f, 20.f), CurrentNormal, Origin, 0),
+      FClimbContact(Origin + FVector(50.f, 10.f, -20.f), CurrentNormal, Origin, 0),
+      FClimbContact(Origin + NextPoint + FVector(0.f, 0.f, 20.f), NextNormal, Origin, 1),
+      FClimbContact(Origin + NextPoint - FVector(0.f, 0.f, 20.f), NextNormal, Origin, 1)
+    };
+  };
+
+  // A wall to the right turning towards the climber
+  const TArray<FClimbContact> InnerContacts = MakeContacts(FVector(30.f, 50.f, 0.f), FVector(0.f, -1.f, 0.f));
+  const FClimbCorner InnerCorner = ClimbSolver::DetectCorner(InnerContacts, Origin, CurrentNormal, Right, 30.f, 60.f);
+  TestTrue(TEXT("Wall turning towards the climber is an inner corner"), InnerCorner.Type == EClimbCornerType::Inner);
+  TestTrue(TEXT("Inner corner is on the next face"), InnerCorner.Location.Equals(Origin + FVector(30.f, 50.f, 0.f), 0.25f));
+  TestTrue(TEXT("Inner corner takes the next face normal"), InnerCorner.Normal.Equals(FVector(0.f, -1.f, 0.f), 1e-3f));
+
+  // The wall ends on the right and wraps around an edge away from the climber
+  const TArray<FClimbContact> OuterContacts = MakeContacts(FVector(70.f, 50.f, 0.f), FVector(0.f, 1.f, 0.f));
+  const FClimbCorner OuterCorner = ClimbSolver::DetectCorner(OuterContacts, Origin, CurrentNormal, Right, 30.f, 60.f);
+  TestTrue(TEXT("Wall wrapping away from the climber is an outer corner"), OuterCorner.Type == EClimbCornerType::Outer);
+  TestTrue(TEXT("Outer corner takes the next face normal"), OuterCorner.Normal.Equals(FVector(0.f, 1.f, 0.f), 1e-3f));
+
+  TestTrue(TEXT("Moving away from the next face is no corner"),
+    ClimbSolver::DetectCorner(InnerContacts, Origin, CurrentNormal, -Right, 30.f, 60.f).Type == EClimbCornerType::None);
+  TestTrue(TEXT("Not moving is no corner"),
+    ClimbSolver::DetectCorner(InnerContacts, Origin, CurrentNormal, FVector::ZeroVector, 30.f, 60.f).Type == EClimbCornerType::None);
+
+  // Floor below and ceiling above, reached by moving onto them
+  const TArray<FClimbContact> FloorContacts = MakeContacts(FVector(40.f, 0.f, -80.f), FVector::UpVector);
+  TestTrue(TEXT("Floor is no corner"),
+    ClimbSolver::DetectCorner(FloorContacts, Origin, CurrentNormal, FVector::DownVector, 30.f, 60.f).Type == EClimbCornerType::None);
+
+  const TArray<FClimbContact> CeilingContacts = MakeContacts(FVector(40.f, 0.f, 80.f), FVector::DownVector);
+  TestTrue(TEXT("Ceiling is no corner"),
+    ClimbSolver::DetectCorner(CeilingContacts, Origin, CurrentNormal, FVector::UpVector, 30.f, 60.f).Type == EClimbCornerType::None);
+
+  return true;
+}
+
+#pragma endregion
+
+#pragma region ClimbBatchSolver
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClimbBatchSolverMatchesScalarTest, "Climber.Core.ClimbBatchSolver.MatchesScalar", ClimberCoreTestFlags)
+
+bool FClimbBatchSolverMatchesScalarTest::RunTest(const FString& Parameters)
+{
+  constexpr float StopAngleDegrees = 60.f;
+  constexpr float FloorReachedSpeed = 10.f;
+  const float StopCos = FMath::Cos(FMath::DegreesToRadians(StopAngleDegrees));
+
+  for (const int32 Seed : { 1, 2, 3 })
+  {
+    FRandomStream RandomStream(Seed);
+    FClimbSolverBatch Batch;
+
+    // Up to 8 contacts jittered around one wall normal per climber, some without any, plus floor hits and climb speeds on either side of the thresholds
+    for (int32 Climber = 0; Climber < 97; Climber++)
+    {
+      const FVector Origin = RandomStream.GetUnitVector() * RandomStream.FRandRange(0.f, 100000.f);
+
+      FVector WallNormal;
+      do
+      {
+        WallNormal = RandomStream.GetUnitVector();
+      }
+      // Stay clear of the stop angle and of straight up or down, where rounding may pick either side of a threshold
+      while (FMath::Abs(WallNormal.Z - StopCos) < 0.15f || FMath::Abs(WallNormal.Z) > 0.9f);
+
+      TArray<FClimbContact> Contacts;
+      const int32 NumContacts = RandomStream.RandRange(0, 8);
+      for (int32 Contact = 0; Contact < NumContacts; Contact++)
+      {
+        const FVector ContactNormal = (WallNormal + RandomStream.GetUnitVector() * 0.1f).GetSafeNormal();
+        Contacts.Emplace(Origin + RandomStream.GetUnitVector() * RandomStream.FRandRange(0.f, 80.f), ContactNormal, Origin, 0);
+      }
+
+      TArray<float> FloorNormalZ;
+      const int32 NumFloors = RandomStream.RandRange(0, 3);
+      for (int32 Floor = 0; Floor < NumFloors; Floor++)
+      {
+        FloorNormalZ.Add(RandomStream.FRand() < 0.5f ? (RandomStream.FRand() < 0.5f ? 1.f : -1.f) : RandomStream.FRandRange(-0.9f, 0.9f));
+      }
+
+      const float ClimbVelocityZ = RandomStream.FRandRange(-100.f, 100.f);
+      Batch.AddClimber(Contacts, Origin, FloorNormalZ, FMath::Abs(FMath::Abs(ClimbVelocityZ) - FloorReachedSpeed) < 1.f ? 0.f : ClimbVelocityZ);
+    }
+
+    FClimbSolverBatchResults BatchResults;
+    FClimbSolverBatchResults ScalarResults;
+    ClimbSolver::SolveBatch(Batch, StopAngleDegrees, FloorReachedSpeed, BatchResults);
+    ClimbSolver::SolveBatchScalar(Batch, StopAngleDegrees, FloorReachedSpeed, ScalarResults);
+
+    for (int32 Climber = 0; Climber < Batch.Num(); Climber++)
+    {
+      const FString Context = FString::Printf(TEXT("seed %d climber %d"), Seed, Climber);
+
+      TestTrue(FString::Printf(TEXT("Location matches for %s"), *Context), BatchResults.GetLocation(Batch, Climber).Equals(ScalarResults.GetLocation(Batch, Climber), 1e-2f));
+      TestTrue(FString::Printf(TEXT("Normal matches for %s"), *Context), BatchResults.GetNormal(Climber).Equals(ScalarResults.GetNormal(Climber), 1e-4f));
+      TestTrue(FString::Printf(TEXT("Rotation matches for %s"), *Context), BatchResults.GetRotation(Climber).AngularDistance(ScalarResults.GetRotation(Climber)) < 1e-3f);
+      TestEqual(FString::Printf(TEXT("Stop flag matches for %s"), *Context), BatchResults.ShouldStopClimbing(Climber), ScalarResults.ShouldStopClimbing(Climber));
+      TestEqual(FString::Printf(TEXT("Floor flag matches for %s"), *Context), BatchResults.HasReachedFloor(Climber), ScalarResults.HasReachedFloor(Climber));
+    }
+  }
+
+  return true;
+}
+
+#pragma endregion
+
+#pragma region ClimbSeparation
+
+namespace ClimberCoreTests
+{
+  // A climber on a wall facing -X
+  FClimbSeparationAgent MakeAgent(const FVector& Location, uint32 WallKey)
+  {
+    FClimbSeparationAgent Agent;
+    Agent.Location = Location;
+    Agent.SurfaceNormal = FVector(-1.f, 0.f, 0.f);
+    Agent.WallKey = WallKey;
+    Agent.Radius = 40.f;
+    Agent.MaxSpeed = 80.f;
+    return Agent;
+  }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClimbSeparationWallKeyTest, "Climber.Core.ClimbSeparation.OnlySameWallInteracts", ClimberCoreTestFlags)
+
+bool FClimbSeparationWallKeyTest::RunTest(const FString& Parameters)
+{
+  const FClimbSeparationAgent Agents[] = {
+    ClimberCoreTests::MakeAgent(FVector(0.f, 0.f, 0.f), 1),
+    ClimberCoreTests::MakeAgent(FVector(0.f, 10.f, 0.f), 2)
+  };
+
+  FVector Velocities[UE_ARRAY_COUNT(Agents)];
+  ClimbSeparation::ComputeSeparation(Agents, Velocities);
+
+  TestTrue(TEXT("Overlapping climbers on different walls do not push each other"), Velocities[0].IsZero() && Velocities[1].IsZero());
+
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClimbSeparationPushTest, "Climber.Core.ClimbSeparation.PushesApartInSurfacePlane", ClimberCoreTestFlags)
+
+bool FClimbSeparationPushTest::RunTest(const FString& Parameters)
+{
+  // 20 apart along the wall and 15 apart off it, a quarter of the way into the 80 separation distance
+  const FClimbSeparationAgent Pair[] = {
+    ClimberCoreTests::MakeAgent(FVector(0.f, 0.f, 0.f), 1),
+    ClimberCoreTests::MakeAgent(FVector(15.f, 20.f, 0.f), 1)
+  };
+
+  FVector PairVelocities[UE_ARRAY_COUNT(Pair)];
+  ClimbSeparation::ComputeSeparation(Pair, PairVelocities);
+
+  TestTrue(TEXT("First climber is pushed away along the wall"), PairVelocities[0].Equals(FVector(0.f, -60.f, 0.f), 1e-3f));
+  TestTrue(TEXT("Second climber is pushed the other way"), PairVelocities[1].Equals(FVector(0.f, 60.f, 0.f), 1e-3f));
+
+  // Three neighbours almost on top of the first climber, their pushes add up past the cap
+  const FClimbSeparationAgent Crowd[] = {
+    ClimberCoreTests::MakeAgent(FVector(0.f, 0.f, 0.f), 1),
+    ClimberCoreTests::MakeAgent(FVector(0.f, 5.f, 0.f), 1),
+    ClimberCoreTests::MakeAgent(FVector(0.f, 5.f, 1.f), 1),
+    ClimberCoreTests::MakeAgent(FVector(0.f, 5.f, -1.f), 1)
+  };
+
+  FVector CrowdVelocities[UE_ARRAY_COUNT(Crowd)];
+  ClimbSeparation::ComputeSeparation(Crowd, CrowdVelocities);
+
+  TestEqual(TEXT("Separation is capped at MaxSpeed"), CrowdVelocities[0].Size(), Crowd[0].MaxSpeed, 1e-3f);
+  TestTrue(TEXT("Capped push still points away"), CrowdVelocities[0].GetSafeNormal().Equals(FVector(0.f, -1.f, 0.f), 1e-3f));
+
+  for (int32 AgentIndex = 0; AgentIndex < UE_ARRAY_COUNT(Crowd); AgentIndex++)
+  {
+    TestTrue(FString::Printf(TEXT("Climber %d stays in its surface plane"), AgentIndex), FMath::IsNearlyZero(CrowdVelocities[AgentIndex].X, 1e-3f));
+  }
+
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClimbSeparationCoincidentTest, "Climber.Core.ClimbSeparation.CoincidentSplit", ClimberCoreTestFlags)
+
+bool FClimbSeparationCoincidentTest::RunTest(const FString& Parameters)
+{
+  const FClimbSeparationAgent Agents[] = {
+    ClimberCoreTests::MakeAgent(FVector(0.f, 0.f, 0.f), 1),
+    ClimberCoreTests::MakeAgent(FVector(0.f, 0.f, 0.f), 1)
+  };
+
+  FVector Velocities[UE_ARRAY_COUNT(Agents)];
+  ClimbSeparation::ComputeSeparation(Agents, Velocities);
+
+  TestEqual(TEXT("Coincident climbers separate at full speed"), Velocities[0].Size(), Agents[0].MaxSpeed, 1e-3f);
+  TestTrue(TEXT("Coincident climbers split to opposite sides"), Velocities[0].Equals(-Velocities[1], 1e-3f));
+  TestTrue(TEXT("Split stays in the surface plane"), FMath::IsNearlyZero(Velocities[0].X, 1e-3f));
+
+  return true;
+}
+
+#pragma endregion
+
+#pragma region ClimbSimulation
+
+namespace ClimberCoreTests
+{
+  // Climbing up a wall facing -X, accelerating from rest
+  FClimbSimInput MakeClimbUpInput()
+  {
+    FClimbSimInput Input;
+    Input.Acceleration = FVector(0.f, 0.f, 2048.f);
+    Input.Surface.Normal = FVector(-1.f, 0.f, 0.f);
+    return Input;
+  }
+
+  FClimbSimParams MakeParams()
+  {
+    FClimbSimParams Params;
+    Params.MaxSpeed = 100.f;
+    Params.BrakingDeceleration = 400.f;
+    return Params;
+  }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClimbSimulationFixedStepTest, "Climber.Core.ClimbSimulation.FixedStepMatchesAnyFrameRate", ClimberCoreTestFlags)
+
+bool FClimbSimulationFixedStepTest::RunTest(const FString& Parameters)
+{
+  const FClimbSimInput Input = ClimberCoreTests::MakeClimbUpInput();
+  const FClimbSimParams Params = ClimberCoreTests::MakeParams();
+
+  // Powers of two, so the accumulator sums exactly and both runs take the same number of steps
+  constexpr float StepDeltaTime = 1.f / 32.f;
+  const float FrameTimes[] = { 1.f / 64.f, 3.f / 64.f };
+
+  FClimbSimState SteadyState;
+  for (int32 StepIndex = 0; StepIndex < 32; StepIndex++)
+  {
+    SteadyState = ClimbSimulation::Step(SteadyState, Input, Params, StepDeltaTime);
+  }
+
+  // One second of uneven frames, stepped through the fixed stepper
+  FClimbSimState UnevenState;
+  FClimbFixedStepper Stepper;
+  int32 TotalSteps = 0;
+  for (int32 FrameIndex = 0; FrameIndex < 32; FrameIndex++)
+  {
+    const int32 NumSteps = Stepper.Advance(FrameTimes[FrameIndex % 2], StepDeltaTime);
+    for (int32 StepIndex = 0; StepIndex < NumSteps; StepIndex++)
+    {
+      UnevenState = ClimbSimulation::Step(UnevenState, Input, Params, StepDeltaTime);
+    }
+    TotalSteps += NumSteps;
+  }
+
+  TestEqual(TEXT("Uneven frames run as many steps as even ones"), TotalSteps, 32);
+  TestTrue(TEXT("Location does not depend on the frame rate"), UnevenState.Location.Equals(SteadyState.Location, 0.f));
+  TestTrue(TEXT("Velocity does not depend on the frame rate"), UnevenState.Velocity.Equals(SteadyState.Velocity, 0.f));
+  TestTrue(TEXT("Rotation does not depend on the frame rate"), UnevenState.Rotation.Equals(SteadyState.Rotation, 0.f));
+
+  // A hitch is cut off at MaxStepsPerFrame and its remainder dropped
+  FClimbFixedStepper HitchStepper;
+  TestEqual(TEXT("Hitch is capped to MaxStepsPerFrame"), HitchStepper.Advance(1.f, StepDeltaTime), HitchStepper.MaxStepsPerFrame);
+  TestEqual(TEXT("Hitch remainder is dropped"), HitchStepper.Accumulator, 0.f);
+
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClimbSimulationStepFrameTest, "Climber.Core.ClimbSimulation.StepFrameMovesEveryFrame", ClimberCoreTestFlags)
+
+bool FClimbSimulationStepFrameTest::RunTest(const FString& Parameters)
+{
+  const FClimbSimInput Input = ClimberCoreTests::MakeClimbUpInput();
+  const FClimbSimParams Params = ClimberCoreTests::MakeParams();
+
+  constexpr float StepDeltaTime = 1.f / 32.f;
+
+  FClimbSimState WholeStepState;
+  for (int32 StepIndex = 0; StepIndex < 16; StepIndex++)
+  {
+    WholeStepState = ClimbSimulation::Step(WholeStepState, Input, Params, StepDeltaTime);
+  }
+
+  // Frames at twice the step rate, every other one has no whole step
+  FClimbSimState PresentedState;
+  FClimbFixedStepper Stepper;
+  float TotalSteppedTime = 0.f;
+  for (int32 FrameIndex = 0; FrameIndex < 32; FrameIndex++)
+  {
+    const FVector PreviousLocation = PresentedState.Location;
+
+    float SteppedTime = 0.f;
+    PresentedState = ClimbSimulation::StepFrame(Stepper, PresentedState, Input, Params, 1.f / 64.f, StepDeltaTime, SteppedTime);
+    TotalSteppedTime += SteppedTime;
+
+    if (!TestTrue(FString::Printf(TEXT("Frame %d moves"), FrameIndex), PresentedState.Location.Z > PreviousLocation.Z)) break;
+  }
+
+  TestEqual(TEXT("Stepped time adds up to the frame time"), TotalSteppedTime, 0.5f, 1e-5f);
+  TestFalse(TEXT("Frames ending on a whole step present no partial step"), Stepper.bHasPartialStep);
+  TestTrue(TEXT("Partial steps leave the whole steps unchanged"), PresentedState.Location.Equals(WholeStepState.Location, 1e-3f) && PresentedState.Velocity.Equals(WholeStepState.Velocity, 0.f));
+
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClimbSimulationVariableStepTest, "Climber.Core.ClimbSimulation.VariableStepConverges", ClimberCoreTestFlags)
+
+bool FClimbSimulationVariableStepTest::RunTest(const FString& Parameters)
+{
+  const FClimbSimInput Input = ClimberCoreTests::MakeClimbUpInput();
+  const FClimbSimParams Params = ClimberCoreTests::MakeParams();
+
+  FClimbSimState FixedState;
+  for (int32 StepIndex = 0; StepIndex < 32; StepIndex++)
+  {
+    FixedState = ClimbSimulation::Step(FixedState, Input, Params, 1.f / 32.f);
+  }
+
+  // Same second stepped straight with the uneven frame times, no accumulator
+  FClimbSimState VariableState;
+  for (int32 FrameIndex = 0; FrameIndex < 32; FrameIndex++)
+  {
+    VariableState = ClimbSimulation::Step(VariableState, Input, Params, FrameIndex % 2 ? 3.f / 64.f : 1.f / 64.f);
+  }
+
+  TestTrue(TEXT("Both reach the max speed"), FixedState.Velocity.Equals(FVector(0.f, 0.f, Params.MaxSpeed), 1e-3f) && VariableState.Velocity.Equals(FixedState.Velocity, 1e-3f));
+  TestTrue(TEXT("Variable steps stay within a frame of travel of fixed steps"), VariableState.Location.Equals(FixedState.Location, Params.MaxSpeed * 3.f / 64.f));
+  TestTrue(TEXT("Both face into the wall"), VariableState.Rotation.GetForwardVector().Equals(FVector(1.f, 0.f, 0.f), 0.05f));
+
+  // Coasting brakes to a stop and never reverses
+  FClimbSimInput CoastInput = Input;
+  CoastInput.Acceleration = FVector::ZeroVector;
+  for (int32 FrameIndex = 0; FrameIndex < 32; FrameIndex++)
+  {
+    VariableState = ClimbSimulation::Step(VariableState, CoastInput, Params, FrameIndex % 2 ? 3.f / 64.f : 1.f / 64.f);
+    if (!TestTrue(TEXT("Braking never reverses the velocity"), VariableState.Velocity.Z >= 0.f)) break;
+  }
+  TestTrue(TEXT("Coasting brakes to a stop"), VariableState.Velocity.IsZero());
+
+  return true;
+}
+
+#pragma endregion
+
+#endif
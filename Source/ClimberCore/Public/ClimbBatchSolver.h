@@ -0,0 +1,89 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ClimbContact.h"
+
+/**
+ * Contacts and floor hits of many climbers in structure of arrays form, solved in one vectorized pass.
+ * Points are kept relative to each climber's contact origin so they stay precise as floats.
+ */
+struct CLIMBERCORE_API FClimbSolverBatch
+{
+  TArray<float> PointX;
+  TArray<float> PointY;
+  TArray<float> PointZ;
+  TArray<float> NormalX;
+  TArray<float> NormalY;
+  TArray<float> NormalZ;
+
+  // Climber i owns contacts [ContactOffsets[i], ContactOffsets[i + 1])
+  TArray<int32> ContactOffsets;
+
+  // Up component of each floor hit normal, climber i owns [FloorOffsets[i], FloorOffsets[i + 1])
+  TArray<float> FloorNormalZ;
+  TArray<int32> FloorOffsets;
+
+  // Climb velocity along each climber's own up axis
+  TArray<float> ClimbVelocityZ;
+
+  TArray<FVector> Origins;
+
+  FClimbSolverBatch();
+
+  void Reset();
+
+  // Returns the climber index in the batch
+  int32 AddClimber(TConstArrayView<FClimbContact> InContacts, const FVector& InOrigin, TConstArrayView<float> InFloorNormalZ, float InClimbVelocityZ);
+
+  FORCEINLINE int32 Num() const { return Origins.Num(); }
+};
+
+struct CLIMBERCORE_API FClimbSolverBatchResults
+{
+  enum EFlags : uint8
+  {
+    ShouldStop = 1 << 0,
+    FloorReached = 1 << 1
+  };
+
+  // Averaged contact location relative to the climber origin
+  TArray<float> LocationX;
+  TArray<float> LocationY;
+  TArray<float> LocationZ;
+  TArray<float> NormalX;
+  TArray<float> NormalY;
+  TArray<float> NormalZ;
+
+  // Rotation facing into the averaged surface, same rotation as ClimbSolver::GetTargetRotation up to the quaternion sign
+  TArray<float> RotationX;
+  TArray<float> RotationY;
+  TArray<float> RotationZ;
+  TArray<float> RotationW;
+
+  TArray<uint8> Flags;
+
+  void SetNum(int32 InNum);
+
+  FORCEINLINE FVector GetLocation(const FClimbSolverBatch& InBatch, int32 InClimber) const
+  {
+    return InBatch.Origins[InClimber] + FVector(LocationX[InClimber], LocationY[InClimber], LocationZ[InClimber]);
+  }
+
+  FORCEINLINE FVector GetNormal(int32 InClimber) const { return FVector(NormalX[InClimber], NormalY[InClimber], NormalZ[InClimber]); }
+  FORCEINLINE FQuat GetRotation(int32 InClimber) const { return FQuat(RotationX[InClimber], RotationY[InClimber], RotationZ[InClimber], RotationW[InClimber]); }
+  FORCEINLINE bool ShouldStopClimbing(int32 InClimber) const { return (Flags[InClimber] & ShouldStop) != 0; }
+  FORCEINLINE bool HasReachedFloor(int32 InClimber) const { return (Flags[InClimber] & FloorReached) != 0; }
+};
+
+namespace ClimbSolver
+{
+  // For every climber of the batch: ReduceContacts, ShouldStopClimbing (also true without contacts),
+  // the climb floor test and GetTargetRotation. Runs the ISPC kernel when it is compiled in and enabled.
+  // Climbers moving down faster than FloorReachedSpeed, in cm/s, stop on a floor they touch.
+  CLIMBERCORE_API void SolveBatch(const FClimbSolverBatch& InBatch, float StopAngleDegrees, float FloorReachedSpeed, FClimbSolverBatchResults& OutResults);
+
+  // Same pass in plain C++, the fallback without ISPC and the reference for the kernel
+  CLIMBERCORE_API void SolveBatchScalar(const FClimbSolverBatch& InBatch, float StopAngleDegrees, float FloorReachedSpeed, FClimbSolverBatchResults& OutResults);
+}
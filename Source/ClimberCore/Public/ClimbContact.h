@@ -0,0 +1,54 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Max number of contacts kept from a single climbable surface trace
+static constexpr int32 MaxClimbContacts = 16;
+
+/**
+ * Compact climb contact, quantized from a FHitResult.
+ * Points are stored relative to the trace origin, so they stay small enough for int16.
+ */
+struct FClimbContact
+{
+  // 1/8 cm precision, +-4096 cm around the origin
+  static constexpr float PointScale = 8.f;
+  static constexpr float NormalScale = 32767.f;
+
+  int16 Point[3];
+  int16 Normal[3];
+  uint8 ComponentIndex;
+
+  FClimbContact() = default;
+
+  FClimbContact(const FVector& InPoint, const FVector& InNormal, const FVector& InOrigin, uint8 InComponentIndex)
+    : ComponentIndex(InComponentIndex)
+  {
+    const FVector LocalPoint = (InPoint - InOrigin) * PointScale;
+    const FVector ScaledNormal = InNormal.GetSafeNormal() * NormalScale;
+
+    for (int32 Axis = 0; Axis < 3; Axis++)
+    {
+      Point[Axis] = Quantize(LocalPoint[Axis]);
+      Normal[Axis] = Quantize(ScaledNormal[Axis]);
+    }
+  }
+
+  FORCEINLINE FVector GetPoint(const FVector& InOrigin) const
+  {
+    return InOrigin + FVector(Point[0], Point[1], Point[2]) / PointScale;
+  }
+
+  FORCEINLINE FVector GetNormal() const
+  {
+    return FVector(Normal[0], Normal[1], Normal[2]) / NormalScale;
+  }
+
+private:
+  static FORCEINLINE int16 Quantize(double Value)
+  {
+    return (int16)FMath::Clamp<int64>(FMath::RoundToInt64(Value), MIN_int16, MAX_int16);
+  }
+};
@@ -0,0 +1,30 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// A climber as seen by the separation pass
+struct FClimbSeparationAgent
+{
+  FVector Location = FVector::ZeroVector;
+  FVector SurfaceNormal = FVector::ZeroVector;
+
+  // Climbers only separate from others on the same wall, e.g. a hash of the climbed component
+  uint32 WallKey = 0;
+
+  // Two climbers separate while closer than the sum of their radii
+  float Radius = 0.f;
+
+  // Separation speed when fully overlapping another climber
+  float MaxSpeed = 0.f;
+};
+
+/**
+ * Surface space avoidance between climbers, from a per-wall spatial hash instead of scene queries
+ */
+namespace ClimbSeparation
+{
+  // Separation velocity of every agent in its own surface plane, growing as neighbours get closer
+  CLIMBERCORE_API void ComputeSeparation(TConstArrayView<FClimbSeparationAgent> Agents, TArrayView<FVector> OutVelocities);
+}
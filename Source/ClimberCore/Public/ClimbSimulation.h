@@ -0,0 +1,78 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ClimbSolver.h"
+
+// Everything a climb step reads and writes, enough to rewind and resimulate a climber
+struct FClimbSimState
+{
+  FVector Location = FVector::ZeroVector;
+  FQuat Rotation = FQuat::Identity;
+  FVector Velocity = FVector::ZeroVector;
+};
+
+// Per step input, constant over the steps of one frame
+struct FClimbSimInput
+{
+  // World space acceleration from the move input, already scaled to MaxAcceleration
+  FVector Acceleration = FVector::ZeroVector;
+
+  FClimbSurface Surface;
+};
+
+struct FClimbSimParams
+{
+  float MaxSpeed = 0.f;
+  float BrakingDeceleration = 0.f;
+  float RotationInterpSpeed = 5.f;
+};
+
+// Splits variable frame times into fixed steps, carrying the remainder over to the next frame
+struct FClimbFixedStepper
+{
+  float Accumulator = 0.f;
+
+  // Bounds the catch-up after a hitch, the time past it is dropped
+  int32 MaxStepsPerFrame = 8;
+
+  // The last StepFrame presented a partial step past its last whole step, rewound before the next one.
+  // Location is rewound by the offset so collision and snapping of the presented state are kept.
+  FVector PartialStepOffset = FVector::ZeroVector;
+  FQuat WholeStepRotation = FQuat::Identity;
+  FVector WholeStepVelocity = FVector::ZeroVector;
+  bool bHasPartialStep = false;
+
+  FORCEINLINE void Reset()
+  {
+    Accumulator = 0.f;
+    PartialStepOffset = FVector::ZeroVector;
+    bHasPartialStep = false;
+  }
+
+  // Returns how many steps of StepDeltaTime to run this frame
+  int32 Advance(float DeltaTime, float StepDeltaTime)
+  {
+    Accumulator += DeltaTime;
+
+    const int32 NumSteps = FMath::Min(FMath::FloorToInt32(Accumulator / StepDeltaTime), MaxStepsPerFrame);
+    Accumulator = NumSteps == MaxStepsPerFrame ? 0.f : Accumulator - NumSteps * StepDeltaTime;
+
+    return NumSteps;
+  }
+};
+
+/**
+ * Fixed step climb locomotion, independent of the movement component so it can run on any thread
+ */
+namespace ClimbSimulation
+{
+  // One step of climb velocity, location and rotation. Velocity matches CalcVelocity with zero friction.
+  CLIMBERCORE_API FClimbSimState Step(const FClimbSimState& InState, const FClimbSimInput& InInput, const FClimbSimParams& InParams, float StepDeltaTime);
+
+  // Runs the whole steps InOutStepper hands out for DeltaTime, then presents a partial step over the time left in its accumulator
+  // so frames without a whole step still move. The partial step is rewound before the next frame, the whole steps stay frame rate independent.
+  // OutSteppedTime is the simulated time between the previous presented state and the returned one.
+  CLIMBERCORE_API FClimbSimState StepFrame(FClimbFixedStepper& InOutStepper, const FClimbSimState& InState, const FClimbSimInput& InInput, const FClimbSimParams& InParams, float DeltaTime, float StepDeltaTime, float& OutSteppedTime);
+}
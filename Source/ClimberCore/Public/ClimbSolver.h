@@ -0,0 +1,65 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ClimbContact.h"
+
+// Averaged surface of a set of climb contacts
+struct FClimbSurface
+{
+  FVector Location = FVector::ZeroVector;
+  FVector Normal = FVector::ZeroVector;
+};
+
+enum class EClimbCornerType : uint8
+{
+  None,
+  // Concave, the next face turns towards the climber
+  Inner,
+  // Convex, the next face turns away around an edge
+  Outer
+};
+
+// Face next to the one being climbed, found in the spread of a single contact set
+struct FClimbCorner
+{
+  EClimbCornerType Type = EClimbCornerType::None;
+  FVector Location = FVector::ZeroVector;
+  FVector Normal = FVector::ZeroVector;
+};
+
+enum class EClimbHopDirection : uint8
+{
+  None,
+  Up,
+  Down
+};
+
+/**
+ * Climb math shared by the movement component, free of any world or UObject state
+ */
+namespace ClimbSolver
+{
+  // Averages contact points and normals, zero surface when there are no contacts
+  CLIMBERCORE_API FClimbSurface ReduceContacts(TConstArrayView<FClimbContact> Contacts, const FVector& Origin);
+
+  // True when the surface is closer to the up vector than StopAngleDegrees, i.e. too flat to climb
+  CLIMBERCORE_API bool ShouldStopClimbing(const FVector& SurfaceNormal, float StopAngleDegrees);
+
+  // Rotation facing into the surface
+  CLIMBERCORE_API FQuat GetTargetRotation(const FVector& SurfaceNormal);
+
+  CLIMBERCORE_API FQuat InterpClimbRotation(const FQuat& CurrentRotation, const FVector& SurfaceNormal, float DeltaTime, float InterpSpeed);
+
+  // Vector pulling the character onto the surface, scaled by its distance to the surface along Forward
+  CLIMBERCORE_API FVector GetSnapVector(const FVector& SurfaceLocation, const FVector& SurfaceNormal, const FVector& Location, const FVector& Forward);
+
+  // Splits the contacts into the face along CurrentNormal and the face deviating from it by more than MinCornerAngleDegrees.
+  // Only reports a corner lying in MoveDirection, so brushing past a corner without moving to it does not trigger a wrap.
+  // A next face that ShouldStopClimbing at StopAngleDegrees, as a floor or as a ceiling, is not a corner.
+  CLIMBERCORE_API FClimbCorner DetectCorner(TConstArrayView<FClimbContact> Contacts, const FVector& Origin, const FVector& CurrentNormal, const FVector& MoveDirection, float MinCornerAngleDegrees, float StopAngleDegrees);
+
+  // Classifies a movement input given in the character local space
+  CLIMBERCORE_API EClimbHopDirection ClassifyHopDirection(const FVector& LocalInput, float DirectionThreshold = 0.9f);
+}
@@ -11,5 +11,6 @@ public class ClimberEditorTarget : TargetRules
 		DefaultBuildSettings = BuildSettingsVersion.V4;
 		IncludeOrderVersion = EngineIncludeOrderVersion.Unreal5_3;
 		ExtraModuleNames.Add("Climber");
+		ExtraModuleNames.Add("ClimberEditor");
 	}
 }
@@ -0,0 +1,57 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbStressMapCommandlet.h"
+#include "ClimbStressMapGenerator.h"
+#include "Engine/World.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogClimbStressMap, Log, All);
+
+UClimbStressMapCommandlet::UClimbStressMapCommandlet()
+{
+  IsClient = false;
+  IsEditor = true;
+  IsServer = false;
+  LogToConsole = true;
+}
+
+int32 UClimbStressMapCommandlet::Main(const FString& Params)
+{
+  FString MapPath;
+  if (!FParse::Value(*Params, TEXT("Map="), MapPath) || !FPackageName::IsValidLongPackageName(MapPath))
+  {
+    UE_LOG(LogClimbStressMap, Error, TEXT("Missing or invalid -Map=<package path>"));
+    return 1;
+  }
+
+  FClimbStressMapSettings Settings;
+  UClimbStressMapGenerator::ParseSettings(*Params, Settings);
+
+  UPackage* MapPackage = CreatePackage(*MapPath);
+  UWorld* World = UWorld::CreateWorld(EWorldType::Editor, false, FName(FPackageName::GetShortName(MapPath)), MapPackage);
+  World->SetFlags(RF_Public | RF_Standalone);
+
+  const int32 NumSpawned = UClimbStressMapGenerator::GenerateStressMap(World, Settings);
+
+  const FString MapFilename = FPackageName::LongPackageNameToFilename(MapPath, FPackageName::GetMapPackageExtension());
+
+  FSavePackageArgs SaveArgs;
+  SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+  const bool bSaved = UPackage::SavePackage(MapPackage, World, *MapFilename, SaveArgs);
+
+  World->DestroyWorld(false);
+
+  if (!bSaved)
+  {
+    UE_LOG(LogClimbStressMap, Error, TEXT("Could not save %s"), *MapFilename);
+    return 1;
+  }
+
+  UE_LOG(LogClimbStressMap, Display, TEXT("Saved %s with %d actors (seed %d, %d walls, %s meshes)"),
+    *MapFilename, NumSpawned, Settings.Seed, Settings.NumWalls, Settings.bUseInstancedMeshes ? TEXT("instanced") : TEXT("unique"));
+
+  return 0;
+}
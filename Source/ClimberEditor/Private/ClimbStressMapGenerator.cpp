@@ -0,0 +1,223 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbStressMapGenerator.h"
+#include "AI/ClimberBotController.h"
+#include "ClimberCollision.h"
+#include "Components/ClimbableInstancedMeshComponent.h"
+#include "Components/CustomMovementComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Editor.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerStart.h"
+
+static FAutoConsoleCommand GenerateStressMapCommand(
+  TEXT("Climber.GenerateStressMap"),
+  TEXT("Generates a climbing stress map into the editor level. Takes the same parameters as the ClimbStressMap commandlet, e.g. -Walls=64 -Overhang=30 -Instanced=0"),
+  FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+  {
+    if (!GEditor) return;
+
+    FClimbStressMapSettings Settings;
+    UClimbStressMapGenerator::ParseSettings(*FString::Join(Args, TEXT(" ")), Settings);
+
+    const int32 NumSpawned = UClimbStressMapGenerator::GenerateStressMap(GEditor->GetEditorWorldContext().World(), Settings);
+    UE_LOG(LogClimbing, Log, TEXT("Generated a climbing stress map with %d actors"), NumSpawned);
+  })
+);
+
+namespace ClimbStressMap
+{
+  const TCHAR* CubeMeshPath = TEXT("/Engine/BasicShapes/Cube.Cube");
+
+  // Engine cube is 100 units wide and centered on its pivot
+  constexpr float CubeSize = 100.f;
+
+  static FTransform MakeBoxTransform(const FVector& InLocalCenter, const FVector& InSize, const FTransform& InParent)
+  {
+    return FTransform(FQuat::Identity, InLocalCenter, InSize / CubeSize) * InParent;
+  }
+
+  static AStaticMeshActor* SpawnBox(UWorld* World, UStaticMesh* CubeMesh, const FTransform& InTransform, bool bClimbable, const FName& InFolder)
+  {
+    AStaticMeshActor* BoxActor = World->SpawnActor<AStaticMeshActor>(AStaticMeshActor::StaticClass(), InTransform);
+    if (!BoxActor) return nullptr;
+
+    UStaticMeshComponent* MeshComponent = BoxActor->GetStaticMeshComponent();
+    MeshComponent->SetMobility(EComponentMobility::Static);
+    MeshComponent->SetStaticMesh(CubeMesh);
+    if (bClimbable)
+    {
+      MeshComponent->SetCollisionProfileName(CLIMBABLE_SURFACE_PROFILE);
+    }
+
+#if WITH_EDITOR
+    BoxActor->SetFolderPath(InFolder);
+#endif
+
+    return BoxActor;
+  }
+}
+
+int32 UClimbStressMapGenerator::GenerateStressMap(UObject* WorldContextObject, const FClimbStressMapSettings& Settings)
+{
+  using namespace ClimbStressMap;
+
+  UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+  UStaticMesh* CubeMesh = LoadObject<UStaticMesh>(nullptr, CubeMeshPath);
+  if (!World || !CubeMesh) return 0;
+
+  FRandomStream RandomStream(Settings.Seed);
+
+  const int32 GridSize = FMath::Max(1, FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Settings.NumWalls))));
+  const float GridExtent = GridSize * Settings.WallSpacing;
+
+  int32 NumSpawned = 0;
+  TArray<FTransform> ClimbablePieces;
+
+  // Ground is walkable but not climbable, so climb sweeps only ever see the generated walls
+  if (SpawnBox(World, CubeMesh, FTransform(FQuat::Identity, FVector(GridExtent * 0.5f, GridExtent * 0.5f, -CubeSize * 0.5f), FVector(GridExtent / CubeSize, GridExtent / CubeSize, 1.f)), false, TEXT("StressMap")))
+  {
+    NumSpawned++;
+  }
+
+  const UClass* BotClass = Settings.BotClass.LoadSynchronous();
+
+  for (int32 WallIndex = 0; WallIndex < Settings.NumWalls; WallIndex++)
+  {
+    const FVector WallBase(
+      (WallIndex % GridSize + 0.5f) * Settings.WallSpacing,
+      (WallIndex / GridSize + 0.5f) * Settings.WallSpacing,
+      0.f);
+
+    const float WallWidth = RandomStream.FRandRange(Settings.WallWidthRange.X, Settings.WallWidthRange.Y);
+    const float WallHeight = RandomStream.FRandRange(Settings.WallHeightRange.X, Settings.WallHeightRange.Y);
+    const float WallYaw = RandomStream.FRandRange(0.f, 360.f);
+    const float OverhangAngle = RandomStream.FRandRange(0.f, Settings.MaxOverhangAngle);
+
+    // Wall space: X out of the climbing face, Y along the face, origin at the bottom of the face center.
+    // Negative pitch leans the top of the wall over the climbing side.
+    const FTransform WallTransform(FRotator(-OverhangAngle, WallYaw, 0.f), WallBase);
+    const float HalfThickness = Settings.WallThickness * 0.5f;
+
+    ClimbablePieces.Add(MakeBoxTransform(FVector(-HalfThickness, 0.f, WallHeight * 0.5f), FVector(Settings.WallThickness, WallWidth, WallHeight), WallTransform));
+
+    if (Settings.LedgeSpacing > 0.f)
+    {
+      for (float LedgeHeight = Settings.LedgeSpacing; LedgeHeight < WallHeight - 50.f; LedgeHeight += Settings.LedgeSpacing)
+      {
+        ClimbablePieces.Add(MakeBoxTransform(FVector(20.f, 0.f, LedgeHeight), FVector(40.f, WallWidth, 20.f), WallTransform));
+      }
+    }
+
+    const int32 NumHolds = FMath::RoundToInt(WallWidth * WallHeight / 10000.f * Settings.SurfaceDensity);
+    for (int32 HoldIndex = 0; HoldIndex < NumHolds; HoldIndex++)
+    {
+      const FVector HoldCenter(10.f, RandomStream.FRandRange(-WallWidth, WallWidth) * 0.5f, RandomStream.FRandRange(0.f, WallHeight));
+      ClimbablePieces.Add(MakeBoxTransform(HoldCenter, FVector(20.f, 30.f, 20.f), WallTransform));
+    }
+
+    // Clutter stays out of the band in front of the wall where the bots start
+    for (int32 ClutterIndex = 0; ClutterIndex < Settings.ClutterPerWall; ClutterIndex++)
+    {
+      const float ClutterSize = RandomStream.FRandRange(30.f, 100.f);
+      const FVector ClutterCenter(
+        RandomStream.FRandRange(-Settings.WallSpacing * 0.4f, -Settings.WallThickness - ClutterSize),
+        RandomStream.FRandRange(-Settings.WallSpacing, Settings.WallSpacing) * 0.4f,
+        ClutterSize * 0.5f);
+
+      const FTransform ClutterTransform = FTransform(FRotator(0.f, RandomStream.FRandRange(0.f, 360.f), 0.f), ClutterCenter, FVector(ClutterSize / CubeSize)) * FTransform(FRotator(0.f, WallYaw, 0.f), WallBase);
+      if (SpawnBox(World, CubeMesh, ClutterTransform, false, TEXT("StressMap/Clutter")))
+      {
+        NumSpawned++;
+      }
+    }
+
+    if (!BotClass) continue;
+
+    const FRotator FacingWall(0.f, WallYaw + 180.f, 0.f);
+    for (int32 BotIndex = 0; BotIndex < Settings.BotsPerWall; BotIndex++)
+    {
+      const float BotOffset = (BotIndex + 0.5f) / Settings.BotsPerWall - 0.5f;
+      const FVector BotLocation = FTransform(FRotator(0.f, WallYaw, 0.f), WallBase).TransformPosition(FVector(250.f, BotOffset * WallWidth * 0.8f, 100.f));
+
+      FActorSpawnParameters SpawnParameters;
+      SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+      APawn* BotPawn = World->SpawnActor<APawn>(const_cast<UClass*>(BotClass), BotLocation, FacingWall, SpawnParameters);
+      if (!BotPawn) continue;
+
+      BotPawn->AIControllerClass = AClimberBotController::StaticClass();
+      BotPawn->AutoPossessAI = EAutoPossessAI::PlacedInWorldOrSpawned;
+      BotPawn->AutoPossessPlayer = EAutoReceiveInput::Disabled;
+
+#if WITH_EDITOR
+      BotPawn->SetFolderPath(TEXT("StressMap/Bots"));
+#endif
+
+      NumSpawned++;
+    }
+  }
+
+  if (Settings.bUseInstancedMeshes)
+  {
+    AActor* InstancesActor = World->SpawnActor<AActor>();
+    UClimbableInstancedMeshComponent* InstancesComponent = NewObject<UClimbableInstancedMeshComponent>(InstancesActor, TEXT("ClimbableInstances"));
+    InstancesComponent->SetMobility(EComponentMobility::Static);
+    InstancesComponent->SetStaticMesh(CubeMesh);
+    InstancesComponent->SetCollisionProfileName(CLIMBABLE_SURFACE_PROFILE);
+    InstancesActor->SetRootComponent(InstancesComponent);
+    InstancesActor->AddInstanceComponent(InstancesComponent);
+    InstancesComponent->RegisterComponent();
+    InstancesComponent->AddInstances(ClimbablePieces, false, true);
+
+#if WITH_EDITOR
+    InstancesActor->SetActorLabel(TEXT("ClimbableInstances"));
+    InstancesActor->SetFolderPath(TEXT("StressMap"));
+#endif
+
+    NumSpawned++;
+  }
+  else
+  {
+    for (const FTransform& PieceTransform : ClimbablePieces)
+    {
+      if (SpawnBox(World, CubeMesh, PieceTransform, true, TEXT("StressMap/Walls")))
+      {
+        NumSpawned++;
+      }
+    }
+  }
+
+  if (World->SpawnActor<APlayerStart>(FVector(-300.f, -300.f, 100.f), FRotator(0.f, 45.f, 0.f)))
+  {
+    NumSpawned++;
+  }
+
+  return NumSpawned;
+}
+
+void UClimbStressMapGenerator::ParseSettings(const TCHAR* Params, FClimbStressMapSettings& InOutSettings)
+{
+  FParse::Value(Params, TEXT("Seed="), InOutSettings.Seed);
+  FParse::Value(Params, TEXT("Walls="), InOutSettings.NumWalls);
+  FParse::Value(Params, TEXT("WallSpacing="), InOutSettings.WallSpacing);
+  FParse::Value(Params, TEXT("Overhang="), InOutSettings.MaxOverhangAngle);
+  FParse::Value(Params, TEXT("Density="), InOutSettings.SurfaceDensity);
+  FParse::Value(Params, TEXT("LedgeSpacing="), InOutSettings.LedgeSpacing);
+  FParse::Value(Params, TEXT("Clutter="), InOutSettings.ClutterPerWall);
+  FParse::Value(Params, TEXT("Bots="), InOutSettings.BotsPerWall);
+  FParse::Bool(Params, TEXT("Instanced="), InOutSettings.bUseInstancedMeshes);
+
+  FString BotClassPath;
+  if (FParse::Value(Params, TEXT("BotClass="), BotClassPath))
+  {
+    InOutSettings.BotClass = TSoftClassPtr<APawn>(FSoftObjectPath(BotClassPath));
+  }
+
+  InOutSettings.NumWalls = FMath::Max(InOutSettings.NumWalls, 0);
+  InOutSettings.WallSpacing = FMath::Max(InOutSettings.WallSpacing, 100.f);
+  InOutSettings.MaxOverhangAngle = FMath::Clamp(InOutSettings.MaxOverhangAngle, 0.f, 60.f);
+}
@@ -0,0 +1,289 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbValidationCommandlet.h"
+#include "ClimberCollision.h"
+#include "Components/CustomMovementComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Character.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogClimbValidation, Log, All);
+
+namespace ClimbValidation
+{
+  struct FSample
+  {
+    FClimbProbeFrame Frame;
+
+    // Samples sharing a column are stacked vertically on the same surface face
+    int32 ColumnIndex = INDEX_NONE;
+    bool bTopOfColumn = false;
+
+    bool bCanStartClimbing = false;
+    bool bHasLedgeAbove = false;
+    bool bCanHopUp = false;
+    bool bCanHopDown = false;
+    bool bCanVault = false;
+    double CostMicroseconds = 0.0;
+  };
+
+  struct FHeatmapCell
+  {
+    int32 NumSamples = 0;
+    int32 NumDeadZones = 0;
+    double TotalCostMicroseconds = 0.0;
+  };
+
+  // Samples the vertical faces of the bounds of a climbable primitive, facing into the primitive
+  static void AddPrimitiveSamples(const UPrimitiveComponent* Primitive, const FClimbProbeFrame& FrameTemplate, float Spacing, float StandOff, int32& InOutNumColumns, TArray<FSample>& OutSamples)
+  {
+    const FBox Bounds = Primitive->Bounds.GetBox();
+    const FVector Center = Bounds.GetCenter();
+    const FVector Extent = Bounds.GetExtent();
+
+    const FVector FaceNormals[] = { FVector::ForwardVector, FVector::BackwardVector, FVector::RightVector, FVector::LeftVector };
+
+    for (const FVector& FaceNormal : FaceNormals)
+    {
+      const FVector FaceTangent = FVector::CrossProduct(FVector::UpVector, FaceNormal);
+      const float FaceHalfWidth = FMath::Abs(FVector::DotProduct(Extent, FaceTangent));
+      const float FaceHalfDepth = FMath::Abs(FVector::DotProduct(Extent, FaceNormal));
+
+      const FVector FaceCenter = Center + FaceNormal * (FaceHalfDepth + StandOff);
+      const int32 NumColumns = FMath::Max(1, FMath::FloorToInt(FaceHalfWidth * 2.f / Spacing));
+      const int32 NumRows = FMath::Max(1, FMath::FloorToInt(Extent.Z * 2.f / Spacing));
+
+      for (int32 Column = 0; Column < NumColumns; Column++)
+      {
+        const float ColumnOffset = -FaceHalfWidth + (Column + 0.5f) * (FaceHalfWidth * 2.f / NumColumns);
+
+        for (int32 Row = 0; Row < NumRows; Row++)
+        {
+          // Probes are traced around the capsule center, start one half height above the bottom of the bounds
+          const float Height = Bounds.Min.Z + FrameTemplate.CapsuleHalfHeight + Row * Spacing;
+          if (Height > Bounds.Max.Z) break;
+
+          FSample& Sample = OutSamples.AddDefaulted_GetRef();
+          Sample.Frame = FrameTemplate;
+          Sample.Frame.Location = FVector(FaceCenter.X, FaceCenter.Y, Height) + FaceTangent * ColumnOffset;
+          Sample.Frame.Rotation = FRotationMatrix::MakeFromX(-FaceNormal).ToQuat();
+          Sample.ColumnIndex = InOutNumColumns;
+          Sample.bTopOfColumn = Row == NumRows - 1 || Height + Spacing > Bounds.Max.Z;
+        }
+
+        InOutNumColumns++;
+      }
+    }
+  }
+}
+
+UClimbValidationCommandlet::UClimbValidationCommandlet()
+{
+  IsClient = false;
+  IsEditor = true;
+  IsServer = false;
+  LogToConsole = true;
+}
+
+int32 UClimbValidationCommandlet::Main(const FString& Params)
+{
+  using namespace ClimbValidation;
+
+  FString MapPath;
+  if (!FParse::Value(*Params, TEXT("Map="), MapPath))
+  {
+    UE_LOG(LogClimbValidation, Error, TEXT("Missing -Map=<package path>"));
+    return 1;
+  }
+
+  FString ClimberClassPath = TEXT("/Game/ClimbingSystem/BP_ClimberCharacter.BP_ClimberCharacter_C");
+  FParse::Value(*Params, TEXT("Climber="), ClimberClassPath);
+
+  float Spacing = 100.f;
+  float StandOff = 60.f;
+  float HeatmapCellSize = 400.f;
+  FParse::Value(*Params, TEXT("Spacing="), Spacing);
+  FParse::Value(*Params, TEXT("StandOff="), StandOff);
+  FParse::Value(*Params, TEXT("HeatmapCellSize="), HeatmapCellSize);
+  Spacing = FMath::Max(Spacing, 10.f);
+  HeatmapCellSize = FMath::Max(HeatmapCellSize, Spacing);
+
+  // Climb probes run on a copy of the climber class movement component, so they use the same tuning
+  const UClass* ClimberClass = LoadClass<ACharacter>(nullptr, *ClimberClassPath);
+  const ACharacter* ClimberCDO = ClimberClass ? ClimberClass->GetDefaultObject<ACharacter>() : nullptr;
+  const UCustomMovementComponent* MovementTemplate = ClimberCDO ? Cast<UCustomMovementComponent>(ClimberCDO->GetCharacterMovement()) : nullptr;
+  if (!MovementTemplate)
+  {
+    UE_LOG(LogClimbValidation, Error, TEXT("%s is not a character using UCustomMovementComponent"), *ClimberClassPath);
+    return 1;
+  }
+
+  UPackage* MapPackage = LoadPackage(nullptr, *MapPath, LOAD_None);
+  UWorld* World = MapPackage ? UWorld::FindWorldInPackage(MapPackage) : nullptr;
+  if (!World)
+  {
+    UE_LOG(LogClimbValidation, Error, TEXT("Could not load map %s"), *MapPath);
+    return 1;
+  }
+
+  World->AddToRoot();
+  World->WorldType = EWorldType::Editor;
+  if (!World->bIsWorldInitialized)
+  {
+    World->InitWorld(UWorld::InitializationValues()
+      .ShouldSimulatePhysics(false)
+      .EnableTraceCollision(true)
+      .CreateNavigation(false)
+      .CreateAISystem(false)
+      .AllowAudioPlayback(false)
+      .CreatePhysicsScene(true));
+  }
+  World->UpdateWorldComponents(true, false);
+
+  if (World->GetWorldPartition())
+  {
+    UE_LOG(LogClimbValidation, Warning, TEXT("%s uses world partition, only actors loaded with the map are validated"), *MapPath);
+  }
+
+  FActorSpawnParameters SpawnParameters;
+  SpawnParameters.ObjectFlags = RF_Transient;
+  AActor* ProbeOwner = World->SpawnActor<AActor>(SpawnParameters);
+  const UCustomMovementComponent* ProbeComponent = NewObject<UCustomMovementComponent>(
+    ProbeOwner, MovementTemplate->GetClass(), NAME_None, RF_Transient, const_cast<UCustomMovementComponent*>(MovementTemplate));
+
+  FClimbProbeFrame FrameTemplate;
+  FrameTemplate.EyeHeight = ClimberCDO->BaseEyeHeight;
+  FrameTemplate.CapsuleHalfHeight = ClimberCDO->GetDefaultHalfHeight();
+
+  TArray<FSample> Samples;
+  int32 NumColumns = 0;
+  int32 NumPrimitives = 0;
+
+  for (TActorIterator<AActor> It(World); It; ++It)
+  {
+    if (*It == ProbeOwner) continue;
+
+    TInlineComponentArray<UPrimitiveComponent*> Primitives(*It);
+    for (const UPrimitiveComponent* Primitive : Primitives)
+    {
+      if (!Primitive->IsRegistered() || !Primitive->IsCollisionEnabled()) continue;
+      if (Primitive->GetCollisionResponseToChannel(ECC_Climbable) != ECR_Block) continue;
+
+      AddPrimitiveSamples(Primitive, FrameTemplate, Spacing, StandOff, NumColumns, Samples);
+      NumPrimitives++;
+    }
+  }
+
+  UE_LOG(LogClimbValidation, Display, TEXT("Validating %d samples on %d climbable primitives"), Samples.Num(), NumPrimitives);
+
+  const double StartTime = FPlatformTime::Seconds();
+
+  // Probes are read only scene queries, so samples are independent and can run on every core
+  ParallelFor(Samples.Num(), [&Samples, ProbeComponent](int32 SampleIndex)
+    {
+      FSample& Sample = Samples[SampleIndex];
+      FVector UnusedPosition;
+      FVector UnusedLandPosition;
+
+      const uint64 StartCycles = FPlatformTime::Cycles64();
+
+      Sample.bCanStartClimbing = ProbeComponent->HasClimbableSurface(Sample.Frame);
+      Sample.bHasLedgeAbove = ProbeComponent->HasLedgeAbove(Sample.Frame);
+      Sample.bCanHopUp = ProbeComponent->CheckCanHopUp(Sample.Frame, UnusedPosition);
+      Sample.bCanHopDown = ProbeComponent->CheckCanHopDown(Sample.Frame, UnusedPosition);
+      Sample.bCanVault = ProbeComponent->CanStartVaulting(Sample.Frame, UnusedPosition, UnusedLandPosition);
+
+      Sample.CostMicroseconds = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000.0;
+    });
+
+  const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+
+  // A column of climbable samples without a ledge at its top cannot be climbed out of
+  TArray<bool> ColumnClimbable;
+  TArray<bool> ColumnHasLedgeTop;
+  ColumnClimbable.Init(false, NumColumns);
+  ColumnHasLedgeTop.Init(false, NumColumns);
+
+  int32 NumDeadZones = 0;
+  TMap<FIntPoint, FHeatmapCell> Heatmap;
+  FString SamplesCsv = TEXT("X,Y,Z,ForwardX,ForwardY,CanStartClimbing,HasLedgeAbove,CanHopUp,CanHopDown,CanVault,CostUs\n");
+
+  for (const FSample& Sample : Samples)
+  {
+    ColumnClimbable[Sample.ColumnIndex] |= Sample.bCanStartClimbing;
+    if (Sample.bTopOfColumn)
+    {
+      ColumnHasLedgeTop[Sample.ColumnIndex] |= Sample.bHasLedgeAbove;
+    }
+
+    const bool bDeadZone = !Sample.bCanStartClimbing;
+    NumDeadZones += bDeadZone;
+
+    const FVector& Location = Sample.Frame.Location;
+    FHeatmapCell& Cell = Heatmap.FindOrAdd(FIntPoint(FMath::FloorToInt(Location.X / HeatmapCellSize), FMath::FloorToInt(Location.Y / HeatmapCellSize)));
+    Cell.NumSamples++;
+    Cell.NumDeadZones += bDeadZone;
+    Cell.TotalCostMicroseconds += Sample.CostMicroseconds;
+
+    const FVector Forward = Sample.Frame.GetForwardVector();
+    SamplesCsv += FString::Printf(TEXT("%.0f,%.0f,%.0f,%.2f,%.2f,%d,%d,%d,%d,%d,%.1f\n"),
+      Location.X, Location.Y, Location.Z, Forward.X, Forward.Y,
+      Sample.bCanStartClimbing, Sample.bHasLedgeAbove, Sample.bCanHopUp, Sample.bCanHopDown, Sample.bCanVault,
+      Sample.CostMicroseconds);
+  }
+
+  int32 NumMissingLedgeTops = 0;
+  for (int32 ColumnIndex = 0; ColumnIndex < NumColumns; ColumnIndex++)
+  {
+    NumMissingLedgeTops += ColumnClimbable[ColumnIndex] && !ColumnHasLedgeTop[ColumnIndex];
+  }
+
+  FString HeatmapCsv = TEXT("CellX,CellY,Samples,DeadZones,AvgCostUs\n");
+  for (const TPair<FIntPoint, FHeatmapCell>& CellPair : Heatmap)
+  {
+    const FHeatmapCell& Cell = CellPair.Value;
+    HeatmapCsv += FString::Printf(TEXT("%d,%d,%d,%d,%.1f\n"),
+      CellPair.Key.X, CellPair.Key.Y, Cell.NumSamples, Cell.NumDeadZones, Cell.TotalCostMicroseconds / Cell.NumSamples);
+  }
+
+  // Most expensive samples, the places where probes take the slow path
+  TArray<const FSample*> Hotspots;
+  for (const FSample& Sample : Samples)
+  {
+    Hotspots.Add(&Sample);
+  }
+  Hotspots.Sort([](const FSample& A, const FSample& B) { return A.CostMicroseconds > B.CostMicroseconds; });
+  Hotspots.SetNum(FMath::Min(Hotspots.Num(), 20));
+
+  FString Report = FString::Printf(TEXT("Map: %s\nClimber: %s\nPrimitives: %d\nSamples: %d\nDead zones: %d\nClimbable columns missing a ledge top: %d\nValidation time: %.2f s\n\nProbe cost hotspots:\n"),
+    *MapPath, *ClimberClassPath, NumPrimitives, Samples.Num(), NumDeadZones, NumMissingLedgeTops, ElapsedSeconds);
+
+  for (const FSample* Hotspot : Hotspots)
+  {
+    Report += FString::Printf(TEXT("  %s  %.1f us\n"), *Hotspot->Frame.Location.ToCompactString(), Hotspot->CostMicroseconds);
+  }
+
+  const FString OutputDirectory = FPaths::ProjectSavedDir() / TEXT("ClimbValidation");
+  const FString MapName = FPackageName::GetShortName(MapPath);
+  IFileManager::Get().MakeDirectory(*OutputDirectory, true);
+
+  FFileHelper::SaveStringToFile(SamplesCsv, *(OutputDirectory / MapName + TEXT("_Samples.csv")));
+  FFileHelper::SaveStringToFile(HeatmapCsv, *(OutputDirectory / MapName + TEXT("_Heatmap.csv")));
+  FFileHelper::SaveStringToFile(Report, *(OutputDirectory / MapName + TEXT("_Report.txt")));
+
+  UE_LOG(LogClimbValidation, Display, TEXT("%s"), *Report);
+
+  // The world was initialized here, tear it down again instead of leaving its scene and subsystems to the exit
+  World->DestroyActor(ProbeOwner);
+  World->DestroyWorld(false);
+  World->RemoveFromRoot();
+
+  return 0;
+}
@@ -0,0 +1,109 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbableCollisionTools.h"
+#include "ClimberCollision.h"
+#include "Components/CustomMovementComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Editor.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/Selection.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "ScopedTransaction.h"
+
+#define LOCTEXT_NAMESPACE "ClimbableCollisionTools"
+
+static FAutoConsoleCommand SetSelectedClimbableCommand(
+  TEXT("Climber.SetSelectedClimbable"),
+  TEXT("Makes the selected actors block the Climbable trace channel. Pass 0 to make them ignore it instead."),
+  FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+  {
+    const bool bClimbable = Args.IsEmpty() || FCString::Atoi(*Args[0]) != 0;
+    const int32 NumChanged = UClimbableCollisionTools::SetSelectedActorsClimbable(bClimbable);
+    UE_LOG(LogClimbing, Log, TEXT("Climbable channel %s on %d primitives"), bClimbable ? TEXT("blocked") : TEXT("ignored"), NumChanged);
+  })
+);
+
+namespace ClimbableCollisionTools
+{
+  // Returns whether the primitive changed
+  static bool SetPrimitiveClimbable(UPrimitiveComponent* Primitive, bool bClimbable)
+  {
+    if (Primitive->GetCollisionEnabled() == ECollisionEnabled::NoCollision) return false;
+
+    const ECollisionResponse ClimbableResponse = bClimbable ? ECR_Block : ECR_Ignore;
+    if (Primitive->GetCollisionResponseToChannel(ECC_Climbable) == ClimbableResponse) return false;
+
+    Primitive->Modify();
+
+    // Level geometry shares the named profile, so later profile edits reach it, anything else keeps its own object type
+    if (Primitive->GetCollisionObjectType() == ECC_WorldStatic)
+    {
+      Primitive->SetCollisionProfileName(bClimbable ? FName(CLIMBABLE_SURFACE_PROFILE) : UCollisionProfile::BlockAll_ProfileName);
+    }
+
+    if (Primitive->GetCollisionResponseToChannel(ECC_Climbable) != ClimbableResponse)
+    {
+      Primitive->SetCollisionResponseToChannel(ECC_Climbable, ClimbableResponse);
+    }
+
+    return true;
+  }
+}
+
+int32 UClimbableCollisionTools::SetActorsClimbable(const TArray<AActor*>& Actors, bool bClimbable)
+{
+  const FScopedTransaction Transaction(LOCTEXT("SetActorsClimbable", "Set Actors Climbable"));
+
+  int32 NumChanged = 0;
+  for (AActor* Actor : Actors)
+  {
+    if (!Actor) continue;
+
+    TInlineComponentArray<UPrimitiveComponent*> Primitives(Actor);
+    for (UPrimitiveComponent* Primitive : Primitives)
+    {
+      NumChanged += ClimbableCollisionTools::SetPrimitiveClimbable(Primitive, bClimbable);
+    }
+  }
+
+  return NumChanged;
+}
+
+int32 UClimbableCollisionTools::SetSelectedActorsClimbable(bool bClimbable)
+{
+  if (!GEditor) return 0;
+
+  TArray<AActor*> SelectedActors;
+  GEditor->GetSelectedActors()->GetSelectedObjects<AActor>(SelectedActors);
+
+  return SetActorsClimbable(SelectedActors, bClimbable);
+}
+
+int32 UClimbableCollisionTools::SetWorldWallsClimbable(UWorld* World, float MinWallHeight)
+{
+  if (!World) return 0;
+
+  const FScopedTransaction Transaction(LOCTEXT("SetWorldWallsClimbable", "Set World Walls Climbable"));
+
+  int32 NumChanged = 0;
+  for (TActorIterator<AActor> It(World); It; ++It)
+  {
+    TInlineComponentArray<UPrimitiveComponent*> Primitives(*It);
+    for (UPrimitiveComponent* Primitive : Primitives)
+    {
+      if (!Primitive->IsRegistered() || Primitive->Mobility != EComponentMobility::Static) continue;
+      if (Primitive->GetCollisionObjectType() != ECC_WorldStatic) continue;
+
+      // Floors and low props stay on their profile
+      if (Primitive->Bounds.BoxExtent.Z * 2.f < MinWallHeight) continue;
+
+      NumChanged += ClimbableCollisionTools::SetPrimitiveClimbable(Primitive, true);
+    }
+  }
+
+  return NumChanged;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,85 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ClimbableMapMigrationCommandlet.h"
+#include "ClimbableCollisionTools.h"
+#include "Engine/World.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogClimbableMapMigration, Log, All);
+
+UClimbableMapMigrationCommandlet::UClimbableMapMigrationCommandlet()
+{
+  IsClient = false;
+  IsEditor = true;
+  IsServer = false;
+  LogToConsole = true;
+}
+
+int32 UClimbableMapMigrationCommandlet::Main(const FString& Params)
+{
+  FString MapPath;
+  if (!FParse::Value(*Params, TEXT("Map="), MapPath) || !FPackageName::IsValidLongPackageName(MapPath))
+  {
+    UE_LOG(LogClimbableMapMigration, Error, TEXT("Missing or invalid -Map=<package path>"));
+    return 1;
+  }
+
+  float MinWallHeight = 200.f;
+  FParse::Value(*Params, TEXT("MinWallHeight="), MinWallHeight);
+
+  UPackage* MapPackage = LoadPackage(nullptr, *MapPath, LOAD_None);
+  UWorld* World = MapPackage ? UWorld::FindWorldInPackage(MapPackage) : nullptr;
+  if (!World)
+  {
+    UE_LOG(LogClimbableMapMigration, Error, TEXT("Could not load map %s"), *MapPath);
+    return 1;
+  }
+
+  if (World->GetWorldPartition())
+  {
+    UE_LOG(LogClimbableMapMigration, Error, TEXT("%s uses world partition, its actors are saved in their own packages, mark them in the editor instead"), *MapPath);
+    return 1;
+  }
+
+  // Wall heights come from the bounds of registered components
+  World->AddToRoot();
+  World->WorldType = EWorldType::Editor;
+  if (!World->bIsWorldInitialized)
+  {
+    World->InitWorld(UWorld::InitializationValues()
+      .ShouldSimulatePhysics(false)
+      .EnableTraceCollision(false)
+      .CreateNavigation(false)
+      .CreateAISystem(false)
+      .AllowAudioPlayback(false)
+      .CreatePhysicsScene(false));
+  }
+  World->UpdateWorldComponents(true, false);
+
+  const int32 NumChanged = UClimbableCollisionTools::SetWorldWallsClimbable(World, MinWallHeight);
+
+  bool bSaved = true;
+  const FString MapFilename = FPackageName::LongPackageNameToFilename(MapPath, FPackageName::GetMapPackageExtension());
+  if (NumChanged > 0)
+  {
+    FSavePackageArgs SaveArgs;
+    SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+    bSaved = UPackage::SavePackage(MapPackage, World, *MapFilename, SaveArgs);
+  }
+
+  World->DestroyWorld(false);
+  World->RemoveFromRoot();
+
+  if (!bSaved)
+  {
+    UE_LOG(LogClimbableMapMigration, Error, TEXT("Could not save %s"), *MapFilename);
+    return 1;
+  }
+
+  UE_LOG(LogClimbableMapMigration, Display, TEXT("%d primitives of %s made climbable"), NumChanged, *MapPath);
+
+  return 0;
+}
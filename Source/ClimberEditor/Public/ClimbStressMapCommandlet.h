@@ -0,0 +1,24 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ClimbStressMapCommandlet.generated.h"
+
+/**
+ * Generates a climbing stress map and saves it as a new level.
+ *
+ * Usage: -run=ClimbStressMap -Map=/Game/Generated/StressMap [-Seed=0] [-Walls=16] [-WallSpacing=1500] [-Overhang=20]
+ *        [-Density=0.5] [-LedgeSpacing=300] [-Clutter=10] [-Instanced=1] [-Bots=2] [-BotClass=<class path>]
+ */
+UCLASS()
+class CLIMBEREDITOR_API UClimbStressMapCommandlet : public UCommandlet
+{
+  GENERATED_BODY()
+
+public:
+  UClimbStressMapCommandlet();
+
+  virtual int32 Main(const FString& Params) override;
+};
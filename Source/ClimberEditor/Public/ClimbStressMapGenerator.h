@@ -0,0 +1,78 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "ClimbStressMapGenerator.generated.h"
+
+class APawn;
+
+USTRUCT(BlueprintType)
+struct FClimbStressMapSettings
+{
+  GENERATED_BODY()
+
+  // Same seed and settings always generate the same level and bot inputs
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stress Map")
+  int32 Seed = 0;
+
+  // Walls are laid out on a square grid
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stress Map")
+  int32 NumWalls = 16;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stress Map")
+  float WallSpacing = 1500.f;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stress Map")
+  FVector2D WallWidthRange = FVector2D(400.f, 1000.f);
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stress Map")
+  FVector2D WallHeightRange = FVector2D(600.f, 1500.f);
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stress Map")
+  float WallThickness = 100.f;
+
+  // Walls lean over their climbing side by up to this angle, 0 for vertical walls
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stress Map", meta = (ClampMin = "0", ClampMax = "60"))
+  float MaxOverhangAngle = 20.f;
+
+  // Climbable holds per square meter of wall face, every hold adds a surface to the climb sweeps
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stress Map", meta = (ClampMin = "0"))
+  float SurfaceDensity = 0.5f;
+
+  // Vertical distance between ledges sticking out of the wall face, 0 for no ledges
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stress Map", meta = (ClampMin = "0"))
+  float LedgeSpacing = 300.f;
+
+  // Non climbable props scattered around each wall
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stress Map", meta = (ClampMin = "0"))
+  int32 ClutterPerWall = 10;
+
+  // Puts all climbable pieces in one climbable instanced mesh instead of one static mesh actor each
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stress Map")
+  bool bUseInstancedMeshes = true;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stress Map", meta = (ClampMin = "0"))
+  int32 BotsPerWall = 2;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stress Map")
+  TSoftClassPtr<APawn> BotClass = TSoftClassPtr<APawn>(FSoftObjectPath(TEXT("/Game/ClimbingSystem/BP_ClimberCharacter.BP_ClimberCharacter_C")));
+};
+
+/**
+ * Generates parameterized climbing levels to measure how trace and movement costs scale with level complexity
+ */
+UCLASS()
+class CLIMBEREDITOR_API UClimbStressMapGenerator : public UBlueprintFunctionLibrary
+{
+  GENERATED_BODY()
+
+public:
+  // Spawns the stress map geometry and bots into the world, returns the number of spawned actors
+  UFUNCTION(BlueprintCallable, Category = "Climbing|Editor", meta = (WorldContext = "WorldContextObject"))
+  static int32 GenerateStressMap(UObject* WorldContextObject, const FClimbStressMapSettings& Settings);
+
+  // Reads settings overrides from commandlet or console parameters, e.g. -Walls=64 -Overhang=30 -Instanced=0
+  static void ParseSettings(const TCHAR* Params, FClimbStressMapSettings& InOutSettings);
+};
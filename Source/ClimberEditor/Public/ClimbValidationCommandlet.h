@@ -0,0 +1,25 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ClimbValidationCommandlet.generated.h"
+
+/**
+ * Loads a map headless and runs the climb probes of a climber class over sample points on every climbable surface.
+ * Writes per sample results, an XY heatmap and a summary report to Saved/ClimbValidation.
+ *
+ * Usage: -run=ClimbValidation -Map=/Game/Maps/MyMap [-Climber=/Game/ClimbingSystem/BP_ClimberCharacter.BP_ClimberCharacter_C]
+ *        [-Spacing=100] [-StandOff=60] [-HeatmapCellSize=400]
+ */
+UCLASS()
+class CLIMBEREDITOR_API UClimbValidationCommandlet : public UCommandlet
+{
+  GENERATED_BODY()
+
+public:
+  UClimbValidationCommandlet();
+
+  virtual int32 Main(const FString& Params) override;
+};
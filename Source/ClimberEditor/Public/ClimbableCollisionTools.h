@@ -0,0 +1,28 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "ClimbableCollisionTools.generated.h"
+
+/**
+ * Editor helpers to bulk assign the Climbable trace channel to level geometry.
+ * WorldStatic primitives get the ClimbableSurface collision profile, other object types only change their Climbable response.
+ */
+UCLASS()
+class CLIMBEREDITOR_API UClimbableCollisionTools : public UBlueprintFunctionLibrary
+{
+  GENERATED_BODY()
+
+public:
+  // Makes every colliding primitive of the actors block (or ignore) the Climbable channel, returns the number of changed primitives
+  UFUNCTION(BlueprintCallable, Category = "Climbing|Editor")
+  static int32 SetActorsClimbable(const TArray<AActor*>& Actors, bool bClimbable);
+
+  UFUNCTION(BlueprintCallable, Category = "Climbing|Editor")
+  static int32 SetSelectedActorsClimbable(bool bClimbable);
+
+  // Makes the walls of the world climbable: static, colliding WorldStatic primitives at least MinWallHeight tall, returns the number of changed primitives
+  static int32 SetWorldWallsClimbable(UWorld* World, float MinWallHeight);
+};
@@ -0,0 +1,24 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ClimbableMapMigrationCommandlet.generated.h"
+
+/**
+ * Gives the walls of a map the ClimbableSurface collision profile and re-saves it.
+ * Maps authored while BlockAll blocked the Climbable channel need this once, BlockAll now ignores it.
+ *
+ * Usage: -run=ClimbableMapMigration -Map=/Game/CR_AnimMap [-MinWallHeight=200]
+ */
+UCLASS()
+class CLIMBEREDITOR_API UClimbableMapMigrationCommandlet : public UCommandlet
+{
+  GENERATED_BODY()
+
+public:
+  UClimbableMapMigrationCommandlet();
+
+  virtual int32 Main(const FString& Params) override;
+};